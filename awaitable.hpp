@@ -0,0 +1,314 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef PROCEDURE_AWAITABLE_MODULE
+#define PROCEDURE_AWAITABLE_MODULE
+#include "procedure.hpp"
+#if defined(__cpp_impl_coroutine) && !defined(PROCEDURE_MODULE_NOCOROUTINE)
+#define PROCEDURE_MODULE_COROUTINE
+#include <atomic>
+#include <coroutine>
+#include <type_traits>
+#endif
+
+/**
+ * @brief
+ *     Coroutine awaitable procedures.
+ * @details
+ *     Allows any operation which takes a completion procedure to be awaited
+ *     by a C++20 coroutine.  The coroutine and atomic headers are only 
+ *     included by this header, and only when coroutines are supported and
+ *     the macro PROCEDURE_MODULE_NOCOROUTINE is not defined, so that 
+ *     procedure.hpp does not depend on them.  Like concurrent.hpp this 
+ *     header is not available when the macro PROCEDURE_MODULE_NOSTDCPP is 
+ *     required.
+ */
+namespace procedure {
+
+#ifdef PROCEDURE_MODULE_COROUTINE
+/**
+ * @brief
+ *     Coroutine awaitable adapter for a completion procedure.
+ * @details
+ *     This type turns any operation which takes a completion procedure 
+ *     into an awaitable object.  Awaiting it suspends the coroutine and 
+ *     calls the initiating object with a SimplyMethodic completion 
+ *     procedure, which is a member of this object and so is stored in the
+ *     coroutine frame without heap allocation.  Calling the completion
+ *     procedure stores its argument and resumes the coroutine directly,
+ *     which then receives the argument as the result of the co_await 
+ *     expression.  The completion procedure must be called exactly once,
+ *     and if it is called before the initiating object returns then the
+ *     coroutine is not suspended, and continues once the initiating object
+ *     returns, so synchronous completions never grow the stack.  Define 
+ *     the macro PROCEDURE_MODULE_NOCOROUTINE to prevent this class.
+ * @tparam Typical
+ *     Type of the initiating object, which is called with a constant 
+ *     Procedural<void, Resultant> reference.
+ * @tparam Resultant
+ *     Parameter type of the completion procedure and result type of the 
+ *     co_await expression.
+ */
+template <class Typical, class Resultant>
+class Awaitable {
+
+public:
+    /**
+     * @brief
+     *     Completion procedure type template instance alias.
+     */
+    using BaseProcedural = Procedural<void, Resultant>;
+
+    /**
+     * @brief
+     *     Completion result storage type.
+     */
+    using Storing = typename ::std::decay<Resultant>::type;
+
+    /**
+     * @brief
+     *     Construct an awaitable operation.
+     * @param[in] initiate
+     *     The initiating object, which is moved or copied into this object.
+     */
+    template <class Initiating>
+    constexpr Awaitable(Initiating&& initiate)
+        : initiate(static_cast<Initiating&&>(initiate))
+        , completion(*this, &Awaitable::resume)
+        , handle()
+        , arrived(false)
+        , storage()
+    {
+    }
+
+    Awaitable(const Awaitable&) = delete;
+
+    Awaitable& operator=(const Awaitable&) = delete;
+
+    /**
+     * @brief
+     *     Coroutine await ready function.
+     * @return
+     *     Always false, the operation is only initiated when suspended.
+     */
+    constexpr bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Coroutine await suspend function.
+     * @details
+     *     Records the coroutine handle and initiates the operation.  The 
+     *     initiating object and the completion procedure both exchange the
+     *     arrived flag once they are done, and only the last of them 
+     *     continues the coroutine.
+     * @param[in] handle
+     *     Handle of the suspended coroutine.
+     * @return
+     *     False only if the operation completed before the initiating 
+     *     object returned, so the coroutine continues without suspending.
+     */
+    bool await_suspend(::std::coroutine_handle<> handle)
+    {
+        this->handle = handle;
+        arrived.store(false, ::std::memory_order_relaxed);
+        initiate(static_cast<const BaseProcedural&>(completion));
+        return !arrived.exchange(true, ::std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief
+     *     Coroutine await resume function.
+     * @return
+     *     The argument which the completion procedure was called with.
+     */
+    Storing await_resume()
+    {
+        Storing& stored = *reinterpret_cast<Storing*>(storage);
+        Storing result(static_cast<Storing&&>(stored));
+        stored.~Storing();
+        return result;
+    }
+
+private:
+    void resume(Resultant result)
+    {
+        new (storage) Storing(static_cast<Resultant&&>(result));
+        if (arrived.exchange(true, ::std::memory_order_acq_rel))
+            handle.resume();
+    }
+
+    Typical initiate; /**< Initiating object. */
+
+    SimplyMethodic<Awaitable, void (Awaitable::*)(Resultant), void, Resultant> completion; /**< Completion procedure. */
+
+    ::std::coroutine_handle<> handle; /**< Suspended coroutine. */
+
+    ::std::atomic<bool> arrived; /**< Set by the first of initiation and completion to finish. */
+
+    alignas(Storing) unsigned char storage[sizeof(Storing)]; /**< Completion result. */
+};
+
+/**
+ * @brief
+ *     Coroutine awaitable adapter for a completion procedure without 
+ *     parameters.
+ * @details
+ *     This specialization is used when the completion procedure has no
+ *     parameters, so the co_await expression has no result.
+ * @tparam Typical
+ *     Type of the initiating object, which is called with a constant 
+ *     Procedural<void> reference.
+ */
+template <class Typical>
+class Awaitable<Typical, void> {
+
+public:
+    /**
+     * @brief
+     *     Completion procedure type template instance alias.
+     */
+    using BaseProcedural = Procedural<void>;
+
+    /**
+     * @brief
+     *     Construct an awaitable operation.
+     * @param[in] initiate
+     *     The initiating object, which is moved or copied into this object.
+     */
+    template <class Initiating>
+    constexpr Awaitable(Initiating&& initiate)
+        : initiate(static_cast<Initiating&&>(initiate))
+        , completion(*this, &Awaitable::resume)
+        , handle()
+        , arrived(false)
+    {
+    }
+
+    Awaitable(const Awaitable&) = delete;
+
+    Awaitable& operator=(const Awaitable&) = delete;
+
+    /**
+     * @brief
+     *     Coroutine await ready function.
+     * @return
+     *     Always false, the operation is only initiated when suspended.
+     */
+    constexpr bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Coroutine await suspend function.
+     * @details
+     *     Records the coroutine handle and initiates the operation.  The 
+     *     initiating object and the completion procedure both exchange the
+     *     arrived flag once they are done, and only the last of them 
+     *     continues the coroutine.
+     * @param[in] handle
+     *     Handle of the suspended coroutine.
+     * @return
+     *     False only if the operation completed before the initiating 
+     *     object returned, so the coroutine continues without suspending.
+     */
+    bool await_suspend(::std::coroutine_handle<> handle)
+    {
+        this->handle = handle;
+        arrived.store(false, ::std::memory_order_relaxed);
+        initiate(static_cast<const BaseProcedural&>(completion));
+        return !arrived.exchange(true, ::std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief
+     *     Coroutine await resume function.
+     */
+    constexpr void await_resume() const noexcept
+    {
+    }
+
+private:
+    void resume()
+    {
+        if (arrived.exchange(true, ::std::memory_order_acq_rel))
+            handle.resume();
+    }
+
+    Typical initiate; /**< Initiating object. */
+
+    SimplyMethodic<Awaitable, void (Awaitable::*)(), void> completion; /**< Completion procedure. */
+
+    ::std::coroutine_handle<> handle; /**< Suspended coroutine. */
+
+    ::std::atomic<bool> arrived; /**< Set by the first of initiation and completion to finish. */
+};
+
+/**
+ * @brief
+ *     Specify an initiating object as a coroutine awaitable operation.
+ * @details
+ *     This function template is used to create an awaitable object from 
+ *     any callable object which initiates an operation with a completion 
+ *     procedure.  The initiating object is copied if it is an lvalue, 
+ *     otherwise it is moved.  Define the macro PROCEDURE_MODULE_NOCOROUTINE
+ *     to prevent this function.
+ * @tparam Typical
+ *     Type of the initiating object, deduced as a forwarding reference.
+ * @tparam Resultant
+ *     Parameter type of the completion procedure.
+ * @param[in] initiate
+ *     The initiating object, which is called with the completion procedure.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Awaitable object which possesses initiate.
+ */
+template <class Typical, class Resultant>
+static constexpr Awaitable<typename ::std::decay<Typical>::type, Resultant>
+ProcureAwaitably(
+    Typical&&
+        initiate,
+    Functional<void, Resultant>*
+        guide)
+{
+    using Specific = Awaitable<typename ::std::decay<Typical>::type, Resultant>;
+    return Specific(static_cast<Typical&&>(initiate));
+}
+
+/**
+ * @brief
+ *     Specify an initiating object as a coroutine awaitable operation 
+ *     without a result.
+ * @details
+ *     This overload is used when the completion procedure has no 
+ *     parameters.  Define the macro PROCEDURE_MODULE_NOCOROUTINE to prevent
+ *     this function.
+ * @tparam Typical
+ *     Type of the initiating object, deduced as a forwarding reference.
+ * @param[in] initiate
+ *     The initiating object, which is called with the completion procedure.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Awaitable object which possesses initiate.
+ */
+template <class Typical>
+static constexpr Awaitable<typename ::std::decay<Typical>::type, void>
+ProcureAwaitably(
+    Typical&&
+        initiate,
+    Functional<void>*
+        guide)
+{
+    using Specific = Awaitable<typename ::std::decay<Typical>::type, void>;
+    return Specific(static_cast<Typical&&>(initiate));
+}
+#endif
+
+}
+
+#endif
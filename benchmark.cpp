@@ -0,0 +1,206 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include "benchmark.conditions"
+#include <functional>
+#include <memory>
+
+using namespace std;
+using namespace procedure;
+using TestPossessive = Possessive<48, void>;
+
+// Link with test_extern.cpp (only)
+void CallProcedure(const Procedural<void>&);
+void CallFunction(const function<void()>&);
+void CallPossessive(const TestPossessive&);
+void CallThinly(ThinlyProcedural<void>);
+void CallRepeatedly(const RepeatedlyProcedural<void>&, Cardinal);
+bool CompareProcedure(const ComparablyProcedural<void>&, const ComparablyProcedural<void>&);
+bool CompareThinly(ThinlyProcedural<void>, ThinlyProcedural<void>);
+
+// Calls performed by each repeated call
+#define BENCHMARK_REPEAT 100
+// Procedures called by each polymorphic loop, of four types in a pseudo random order
+#define BENCHMARK_MIXED 64
+
+// Benchmark targets, which do no I/O
+unsigned long Count = 0;
+struct Counter {
+    void operator()() { Count++; }
+    void run() { Count++; }
+    void add(unsigned long step) { Count += step; }
+} Object;
+void Function() { Count++; }
+
+// Lifetime tracked targets, by an intrusive tracker or by shared ownership
+struct TrackedCounter : Counter, Trackable {
+} Tracked;
+const shared_ptr<Counter> Shared = make_shared<Counter>();
+
+// Composition stages, where the inner result is passed to the outer stage
+struct {
+    unsigned long operator()() const { return Count + 1; }
+} Produced;
+struct {
+    void operator()(unsigned long value) const { Count = value; }
+} Consumed;
+
+// Opcode dispatch targets, through a constant table or a switch statement
+enum Opcode { Increment, Decrement, Twice, Clear };
+void Incremented() { Count++; }
+void Decremented() { Count--; }
+void Twiced() { Count += 2; }
+void Cleared() { Count = 1; }
+constexpr auto Opcodes = ProcureTabularly<Opcode>(
+    ProcureThinly<decltype(&Incremented), &Incremented>(Guide<void>),
+    ProcureThinly<decltype(&Decremented), &Decremented>(Guide<void>),
+    ProcureThinly<decltype(&Twiced), &Twiced>(Guide<void>),
+    ProcureThinly<decltype(&Cleared), &Cleared>(Guide<void>));
+__attribute__((noinline)) void Switched(Opcode opcode)
+{
+    switch (opcode) {
+    case Increment:
+        Incremented();
+        break;
+    case Decrement:
+        Decremented();
+        break;
+    case Twice:
+        Twiced();
+        break;
+    case Clear:
+        Cleared();
+        break;
+    }
+}
+__attribute__((noinline)) void Tabulated(Opcode opcode)
+{
+    Opcodes(opcode);
+}
+
+template <class Producible, class Callable>
+static void Run(const char* name, Producible produce, Callable call)
+{
+    BenchmarkReport(name, "construct", BenchmarkMeasure([&] {
+        auto procedure = produce();
+        BenchmarkEscape(procedure);
+    }));
+    auto procedure = produce();
+    BenchmarkReport(name, "copy", BenchmarkMeasure([&] {
+        auto copy = procedure;
+        BenchmarkEscape(copy);
+    }));
+    BenchmarkReport(name, "call", BenchmarkMeasure([&] {
+        call(procedure);
+    }));
+}
+
+template <class Producible, class Comparative>
+static void Compare(const char* name, Producible produce, Comparative compare)
+{
+    const auto procedure = produce();
+    const auto relative = produce();
+    BenchmarkReport(name, "compare", BenchmarkMeasure([&] {
+        bool equal = compare(procedure, relative);
+        BenchmarkEscape(equal);
+    }));
+}
+
+int main()
+{
+    BenchmarkHeader();
+    Run("procure_object", [] { return Procure(Object, Guide<void>); }, CallProcedure);
+    Run("procure_function", [] { return Procure(Function); }, CallProcedure);
+    Run("procure_method", [] { return Procure(Object, &Counter::run, Guide<void>); }, CallProcedure);
+    Run("statically_method", [] { return Procure<decltype(&Counter::run), &Counter::run>(Object, Guide<void>); }, CallProcedure);
+    Run("comparably_object", [] { return ProcureComparably(Object, Guide<void>); }, CallProcedure);
+    Compare("comparably_object", [] { return ProcureComparably(Object, Guide<void>); }, CompareProcedure);
+    Run("comparably_method", [] { return ProcureComparably(Object, &Counter::run, Guide<void>); }, CallProcedure);
+    Compare("comparably_method", [] { return ProcureComparably(Object, &Counter::run, Guide<void>); }, CompareProcedure);
+    Run("stdfunction_object", [] { return function<void()>(Object); }, CallFunction);
+    Run("stdfunction_function", [] { return function<void()>(Function); }, CallFunction);
+    Run("stdfunction_method", [] { return function<void()>(bind(&Counter::run, &Object)); }, CallFunction);
+    Run("partially_method", [] { return ProcurePartially(Object, &Counter::add, Guide<void>, 1UL); }, CallProcedure);
+    Run("stdfunction_bind", [] { return function<void()>(bind(&Counter::add, &Object, 1UL)); }, CallFunction);
+    Run("trackable_method", [] { return ProcureTrackably(Tracked, &Counter::run, Guide<void>); }, CallProcedure);
+    Run("stdfunction_weak", [] {
+        return function<void()>([weak = weak_ptr<Counter>(Shared)] {
+            if (const auto locked = weak.lock())
+                locked->run();
+        });
+    }, CallFunction);
+    Run("possessive_object", [] { return TestPossessive(Object); }, CallPossessive);
+    Run("possessive_method", [] { return TestPossessive(Procure(Object, &Counter::run, Guide<void>)); }, CallPossessive);
+    Run("thinly_object", [] { return ProcureThinly(Object, Guide<void>); }, CallThinly);
+    Compare("thinly_object", [] { return ProcureThinly(Object, Guide<void>); }, CompareThinly);
+    Run("thinly_method", [] { return ProcureThinly<decltype(&Counter::run), &Counter::run>(Object, Guide<void>); }, CallThinly);
+    const auto repeatedly = ProcureRepeatedly(Object, Guide<void>);
+    BenchmarkReport("repeatedly_object", "call", BenchmarkMeasure([&] {
+        CallRepeatedly(repeatedly, BENCHMARK_REPEAT);
+    }, BENCHMARK_REPEAT));
+    auto lambda = [] { Count++; };
+    using Mixed = Alternative<void(),
+        SimplyObjective<Counter, void>,
+        SimplyObjective<void(), void>,
+        SimplyMethodic<Counter, decltype(&Counter::run), void>,
+        SimplyObjective<decltype(lambda), void>>;
+    static const auto object = Procure(Object, Guide<void>);
+    static const auto function = Procure(Function);
+    static const auto method = Procure(Object, &Counter::run, Guide<void>);
+    static const auto lambdaic = Procure(lambda, Guide<void>);
+    static const Procedural<void>* virtuals[BENCHMARK_MIXED];
+    static const Mixed* alternatives[BENCHMARK_MIXED];
+    static const Mixed mixed[] = { object, function, method, lambdaic };
+    const Procedural<void>* const procedures[] = { &object, &function, &method, &lambdaic };
+    unsigned long long seed = 1;
+    for (Cardinal index = 0; index < BENCHMARK_MIXED; index++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        virtuals[index] = procedures[seed >> 62];
+        alternatives[index] = &mixed[seed >> 62];
+    }
+    BenchmarkReport("virtual_mixed", "call", BenchmarkMeasure([] {
+        for (const Procedural<void>* procedure : virtuals)
+            (*procedure)();
+    }, BENCHMARK_MIXED));
+    BenchmarkReport("alternative_mixed", "call", BenchmarkMeasure([] {
+        for (const Mixed* procedure : alternatives)
+            (*procedure)();
+    }, BENCHMARK_MIXED));
+    static const auto produced = Procure(Produced, Guide<unsigned long>);
+    static const auto consumed = Procure(Consumed, Guide<void, unsigned long>);
+    static const Procedural<unsigned long>& inner = produced;
+    static const Procedural<void, unsigned long>& outer = consumed;
+    Run("composed_concrete", [] { return Compose(consumed, produced, Guide<void>); }, CallProcedure);
+    Run("composed_virtual", [] { return Compose(outer, inner, Guide<void>); }, CallProcedure);
+    static unsigned opcode = 0;
+    BenchmarkReport("tabular_opcode", "call", BenchmarkMeasure([] {
+        Tabulated(static_cast<Opcode>(opcode++ & 3));
+    }));
+    BenchmarkReport("switch_opcode", "call", BenchmarkMeasure([] {
+        Switched(static_cast<Opcode>(opcode++ & 3));
+    }));
+    static Monotonic<1 << 16> monotonic;
+    BenchmarkReport("monotonic_method", "retain", BenchmarkMeasure([] {
+        auto procedure = monotonic.retain(ProcureComparably(Object, &Counter::run, Guide<void>));
+        if (!procedure) {
+            monotonic.clear();
+            procedure = monotonic.retain(ProcureComparably(Object, &Counter::run, Guide<void>));
+        }
+        BenchmarkEscape(procedure);
+    }));
+    static Pooling<48, 64> pooling;
+    BenchmarkReport("pooling_method", "retain", BenchmarkMeasure([] {
+        auto procedure = pooling.retain(ProcureComparably(Object, &Counter::run, Guide<void>));
+        BenchmarkEscape(procedure);
+        pooling.release(procedure);
+    }));
+    struct Retained final : ComparablyMethodic<Counter, decltype(&Counter::run), void> {
+        using ComparablyMethodic::ComparablyMethodic;
+    };
+    BenchmarkReport("new_method", "retain", BenchmarkMeasure([] {
+        auto procedure = new Retained(Object, &Counter::run);
+        BenchmarkEscape(procedure);
+        delete procedure;
+    }));
+    return Count == 0;
+}
@@ -0,0 +1,1433 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef PROCEDURE_CONCURRENT_MODULE
+#define PROCEDURE_CONCURRENT_MODULE
+#include "procedure.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#ifndef PROCEDURE_MODULE_NOTHROW
+#include <exception>
+#endif
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief   
+ *     Concurrent procedure call facilities.
+ * @details 
+ *     Allows procedures to be handed between threads without heap 
+ *     allocation or locks.  This header requires the C++ standard library
+ *     atomic header, so unlike procedure.hpp it is not available when the
+ *     macro PROCEDURE_MODULE_NOSTDCPP is required.
+ */
+namespace procedure {
+
+/**
+ * @brief
+ *     Size in bytes of the cache line which concurrently written members 
+ *     are aligned to, to prevent false sharing.
+ */
+constexpr Cardinal CacheLine = 64;
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief
+ *     Bounded lock free multiple producer single consumer procedure queue.
+ * @details
+ *     This type is used to post procedures from any number of threads to
+ *     be called by one consumer thread.  Each procedure is stored in a 
+ *     cache line aligned slot as a Possessive, which is constructed in 
+ *     place by post and called then destroyed in place by call, so no heap
+ *     allocation is ever made.  If a procedure throws an exception from 
+ *     call, it is not destroyed and the queue must not be used again.
+ * @tparam Length
+ *     Number of slots, which must be a power of two.
+ * @tparam Capacity
+ *     Size in bytes of the Possessive inline storage in each slot.
+ */
+template <Cardinal Length, Cardinal Capacity>
+class Queueing {
+
+    static_assert(
+        Length && !(Length & (Length - 1)),
+        "Length: Power of two required");
+
+public:
+    /**
+     * @brief
+     *     Possessive procedure type which is stored in each slot.
+     */
+    using SamePossessive = Possessive<Capacity, void>;
+
+    /**
+     * @brief
+     *     Construct an empty queue.
+     */
+    Queueing()
+        : tail(0)
+        , head(0)
+    {
+        for (Cardinal index = 0; index < Length; index++)
+            slots[index].sequence.store(index, ::std::memory_order_relaxed);
+    }
+
+    Queueing(const Queueing&) = delete;
+
+    Queueing& operator=(const Queueing&) = delete;
+
+    /**
+     * @brief
+     *     Destroy any procedures which have not been called.
+     */
+    ~Queueing()
+    {
+        while (Pending* pending = peek()) {
+            pending->~SamePossessive();
+            release();
+        }
+    }
+
+    /**
+     * @brief
+     *     Post a procedure to be called by the consumer.
+     * @details
+     *     May be called by any number of threads at once.  The callable 
+     *     object is copied or moved into a slot by the Possessive 
+     *     constructor.  If that throws an exception, the slot is published
+     *     empty, so that call skips it, and the exception is rethrown.
+     * @tparam Typical
+     *     Type of the callable object, deduced as a forwarding reference.
+     * @param[in] object
+     *     The callable object which will be possessed.
+     * @return
+     *     False only if the queue is full.
+     */
+    template <class Typical>
+    bool post(Typical&& object)
+    {
+        using namespace std;
+        Cardinal position = tail.load(memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[position & (Length - 1)];
+            const Cardinal difference = slot.sequence.load(memory_order_acquire) - position;
+            if (difference == 0) {
+                if (tail.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+#ifndef PROCEDURE_MODULE_NOTHROW
+                    try {
+                        new (slot.storage) SamePossessive(static_cast<Typical&&>(object));
+                    } catch (...) {
+                        new (slot.storage) SamePossessive();
+                        slot.sequence.store(position + 1, memory_order_release);
+                        throw;
+                    }
+#else
+                    new (slot.storage) SamePossessive(static_cast<Typical&&>(object));
+#endif
+                    slot.sequence.store(position + 1, memory_order_release);
+                    return true;
+                }
+            } else if (difference > Cardinal(-1) / 2) {
+                return false;
+            } else {
+                position = tail.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief
+     *     Call and destroy the oldest posted procedure.
+     * @details
+     *     Must only be called by the consumer thread.  Empty slots left by a
+     *     post which threw are released without being counted.
+     * @return
+     *     False only if no posted procedure was available.
+     */
+    bool call()
+    {
+        while (Pending* const pending = peek()) {
+            const bool posted = static_cast<bool>(*pending);
+            if (posted)
+                (*pending)();
+            pending->~SamePossessive();
+            release();
+            if (posted)
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Call and destroy posted procedures until none are available.
+     * @details
+     *     Must only be called by the consumer thread.
+     * @param[in] limit
+     *     Maximum number of procedures to call.
+     * @return
+     *     Number of procedures which were called.
+     */
+    Cardinal drain(Cardinal limit = Cardinal(-1))
+    {
+        Cardinal count = 0;
+        while (count < limit && call())
+            count++;
+        return count;
+    }
+
+private:
+    using Pending = SamePossessive;
+
+    struct alignas(CacheLine) Slot {
+        ::std::atomic<Cardinal> sequence;
+        alignas(SamePossessive) unsigned char storage[sizeof(SamePossessive)];
+    };
+
+    Pending* peek()
+    {
+        Slot& slot = slots[head & (Length - 1)];
+        if (slot.sequence.load(::std::memory_order_acquire) != head + 1)
+            return 0;
+        return reinterpret_cast<Pending*>(slot.storage);
+    }
+
+    void release()
+    {
+        slots[head & (Length - 1)].sequence.store(head + Length, ::std::memory_order_release);
+        head++;
+    }
+
+    Slot slots[Length]; /**< Procedure slots. */
+
+    alignas(CacheLine) ::std::atomic<Cardinal> tail; /**< Next position to post. */
+
+    alignas(CacheLine) Cardinal head; /**< Next position to call, consumer only. */
+};
+
+
+/**
+ * @brief
+ *     Bounded lock free work stealing procedure deque.
+ * @details
+ *     This type is the Chase-Lev deque, where the owner thread pushes and
+ *     pops procedures at the bottom and any other thread steals them from 
+ *     the top.  Procedures are stored by value as Possessive objects in 
+ *     fixed slots, so no heap allocation is ever made.  A slot is only read
+ *     by the thread which claimed its position and is only reused once the
+ *     claiming thread has moved the procedure out of it.
+ * @tparam Length
+ *     Number of slots, which must be a power of two.
+ * @tparam Capacity
+ *     Size in bytes of the Possessive inline storage in each slot.
+ */
+template <Cardinal Length, Cardinal Capacity>
+class Stealable {
+
+    static_assert(
+        Length && !(Length & (Length - 1)),
+        "Length: Power of two required");
+
+public:
+    /**
+     * @brief
+     *     Possessive procedure type which is stored in each slot.
+     */
+    using SamePossessive = Possessive<Capacity, void>;
+
+    /**
+     * @brief
+     *     Construct an empty deque.
+     */
+    Stealable()
+        : top(0)
+        , bottom(0)
+    {
+        for (Cardinal index = 0; index < Length; index++)
+            slots[index].occupied.store(false, ::std::memory_order_relaxed);
+    }
+
+    Stealable(const Stealable&) = delete;
+
+    Stealable& operator=(const Stealable&) = delete;
+
+    /**
+     * @brief
+     *     Destroy any procedures which have not been taken.
+     */
+    ~Stealable()
+    {
+        SamePossessive procedure;
+        while (pop(procedure))
+            ;
+    }
+
+    /**
+     * @brief
+     *     Push a procedure onto the bottom.
+     * @details
+     *     Must only be called by the owner thread.
+     * @tparam Typical
+     *     Type of the callable object, deduced as a forwarding reference.
+     * @param[in] object
+     *     The callable object which will be possessed.
+     * @return
+     *     False only if the deque is full.
+     */
+    template <class Typical>
+    bool push(Typical&& object)
+    {
+        using namespace std;
+        const long long position = bottom.load(memory_order_relaxed);
+        if (position - top.load(memory_order_acquire) >= static_cast<long long>(Length))
+            return false;
+        Slot& slot = slots[position & (Length - 1)];
+        if (slot.occupied.load(memory_order_acquire))
+            return false;
+        new (slot.storage) SamePossessive(static_cast<Typical&&>(object));
+        slot.occupied.store(true, memory_order_relaxed);
+        bottom.store(position + 1, memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Pop the most recently pushed procedure from the bottom.
+     * @details
+     *     Must only be called by the owner thread.
+     * @param[out] procedure
+     *     Assigned the procedure which was popped.
+     * @return
+     *     False only if the deque was empty.
+     */
+    bool pop(SamePossessive& procedure)
+    {
+        using namespace std;
+        const long long position = bottom.load(memory_order_relaxed) - 1;
+        bottom.store(position, memory_order_seq_cst);
+        long long first = top.load(memory_order_seq_cst);
+        if (first > position) {
+            bottom.store(position + 1, memory_order_relaxed);
+            return false;
+        }
+        if (first == position) {
+            const bool claimed = top.compare_exchange_strong(first, first + 1, memory_order_seq_cst, memory_order_relaxed);
+            bottom.store(position + 1, memory_order_relaxed);
+            if (!claimed)
+                return false;
+        }
+        take(position, procedure);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Steal the least recently pushed procedure from the top.
+     * @details
+     *     May be called by any thread.  Fails if another thread claims the
+     *     same procedure first.
+     * @param[out] procedure
+     *     Assigned the procedure which was stolen.
+     * @return
+     *     False only if no procedure was stolen.
+     */
+    bool steal(SamePossessive& procedure)
+    {
+        using namespace std;
+        long long first = top.load(memory_order_seq_cst);
+        const long long last = bottom.load(memory_order_seq_cst);
+        if (first >= last)
+            return false;
+        if (!top.compare_exchange_strong(first, first + 1, memory_order_seq_cst, memory_order_relaxed))
+            return false;
+        take(first, procedure);
+        return true;
+    }
+
+private:
+    struct Slot {
+        ::std::atomic<bool> occupied;
+        alignas(SamePossessive) unsigned char storage[sizeof(SamePossessive)];
+    };
+
+    void take(long long position, SamePossessive& procedure)
+    {
+        Slot& slot = slots[position & (Length - 1)];
+        SamePossessive& stored = *reinterpret_cast<SamePossessive*>(slot.storage);
+        procedure = static_cast<SamePossessive&&>(stored);
+        stored.~SamePossessive();
+        slot.occupied.store(false, ::std::memory_order_release);
+    }
+
+    Slot slots[Length]; /**< Procedure slots. */
+
+    alignas(CacheLine) ::std::atomic<long long> top; /**< Next position to steal. */
+
+    alignas(CacheLine) ::std::atomic<long long> bottom; /**< Next position to push. */
+};
+
+/**
+ * @brief
+ *     Work stealing procedure executor.
+ * @details
+ *     This type runs posted procedures on a fixed number of worker threads.
+ *     Each worker owns a Stealable deque, which procedures posted by that
+ *     worker are pushed onto, and a Queueing inbox, which procedures posted
+ *     by other threads are distributed to in turn.  An idle worker steals
+ *     from the other deques.  Procedures are stored by value as Possessive
+ *     objects, so posting never allocates.  Worker threads are created by
+ *     the constructor and joined by the destructor, after every posted 
+ *     procedure has been called.
+ * @tparam Length
+ *     Number of slots in each deque and inbox, a power of two.
+ * @tparam Capacity
+ *     Size in bytes of the Possessive inline storage of each procedure.
+ */
+template <Cardinal Length, Cardinal Capacity>
+class Executive {
+
+public:
+    /**
+     * @brief
+     *     Possessive procedure type which is posted.
+     */
+    using SamePossessive = Possessive<Capacity, void>;
+
+    /**
+     * @brief
+     *     Range body procedural type used by iterate.
+     */
+    using RangeProcedural = Procedural<void, Cardinal, Cardinal>;
+
+    /**
+     * @brief
+     *     Construct an executor and start its worker threads.
+     * @param[in] count
+     *     Number of worker threads.
+     */
+    explicit Executive(Cardinal count)
+        : count(count ? count : 1)
+        , memory(new unsigned char[this->count * sizeof(Worker) + alignof(Worker)])
+        , workers(Align(memory))
+        , next(0)
+        , pending(0)
+        , stopping(false)
+    {
+        for (Cardinal index = 0; index < this->count; index++)
+            new (&workers[index]) Worker;
+        for (Cardinal index = 0; index < this->count; index++)
+            workers[index].thread = ::std::thread(&Executive::work, this, index);
+    }
+
+    Executive(const Executive&) = delete;
+
+    Executive& operator=(const Executive&) = delete;
+
+    /**
+     * @brief
+     *     Wait for every posted procedure, then join the worker threads.
+     */
+    ~Executive()
+    {
+        wait();
+        stopping.store(true, ::std::memory_order_release);
+        for (Cardinal index = 0; index < count; index++)
+            workers[index].thread.join();
+        for (Cardinal index = 0; index < count; index++)
+            workers[index].~Worker();
+        delete[] memory;
+    }
+
+    /**
+     * @brief
+     *     Number of worker threads.
+     * @return
+     *     The count given to the constructor, or one if it was zero.
+     */
+    Cardinal concurrency() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief
+     *     Post a procedure to be called by a worker thread.
+     * @details
+     *     From a worker thread the procedure is pushed onto its own deque,
+     *     otherwise it is posted to the inbox of the next worker.  If there
+     *     is no room the procedure is called immediately instead.  If 
+     *     possessing or calling the object throws an exception, it is not 
+     *     counted as pending and the exception is rethrown.
+     * @tparam Typical
+     *     Type of the callable object, deduced as a forwarding reference.
+     * @param[in] object
+     *     The callable object which will be possessed.
+     */
+    template <class Typical>
+    void post(Typical&& object)
+    {
+        pending.fetch_add(1, ::std::memory_order_relaxed);
+#ifndef PROCEDURE_MODULE_NOTHROW
+        try {
+            if (place(static_cast<Typical&&>(object)))
+                return;
+            object();
+        } catch (...) {
+            Done();
+            throw;
+        }
+#else
+        if (place(static_cast<Typical&&>(object)))
+            return;
+        object();
+#endif
+        Done();
+    }
+
+    /**
+     * @brief
+     *     Call body over a range in parallel.
+     * @details
+     *     The range is split in halves until each part is no longer than 
+     *     grain, with one half posted and the other split further, and body
+     *     is called once with the bounds of each part.  The calling thread
+     *     helps until every part has been called.
+     * @param[in] first
+     *     Start of the range.
+     * @param[in] last
+     *     End of the range, which is excluded.
+     * @param[in] body
+     *     Procedure called with the start and end of each part.
+     * @param[in] grain
+     *     Maximum length of each part.
+     */
+    void iterate(Cardinal first, Cardinal last, const RangeProcedural& body, Cardinal grain = 1)
+    {
+        Ranging ranging = { this, &body, grain ? grain : 1, { 1 } };
+        Split(ranging, first, last);
+        while (ranging.parts.load(::std::memory_order_acquire))
+            help();
+    }
+
+    /**
+     * @brief
+     *     Call one pending procedure from any thread.
+     * @return
+     *     False only if no procedure was found.
+     */
+    bool help()
+    {
+        SamePossessive procedure;
+        if (Current() == this) {
+            Worker& worker = workers[Index()];
+            if (worker.deque.pop(procedure))
+                return Run(procedure);
+            if (worker.inbox.call())
+                return Done();
+        }
+        for (Cardinal offset = 0; offset < count; offset++)
+            if (workers[(Index() + offset) % count].deque.steal(procedure))
+                return Run(procedure);
+        ::std::this_thread::yield();
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Wait until every posted procedure has been called.
+     * @details
+     *     Must not be called by a worker thread.
+     */
+    void wait()
+    {
+        while (pending.load(::std::memory_order_acquire))
+            help();
+    }
+
+private:
+    struct Worker {
+        Stealable<Length, Capacity> deque;
+        Queueing<Length, Capacity> inbox;
+        ::std::thread thread;
+    };
+
+    struct Ranging {
+        Executive* executive;
+        const RangeProcedural* body;
+        Cardinal grain;
+        ::std::atomic<Cardinal> parts;
+    };
+
+    static Worker* Align(unsigned char* memory)
+    {
+        const Cardinal misalignment = reinterpret_cast<Cardinal>(memory) % alignof(Worker);
+        return reinterpret_cast<Worker*>(memory + (misalignment ? alignof(Worker) - misalignment : 0));
+    }
+
+    static const Executive*& Current()
+    {
+        static thread_local const Executive* current = 0;
+        return current;
+    }
+
+    static Cardinal& Index()
+    {
+        static thread_local Cardinal index = 0;
+        return index;
+    }
+
+    static void Split(Ranging& ranging, Cardinal first, Cardinal last)
+    {
+        while (last - first > ranging.grain) {
+            const Cardinal middle = first + (last - first) / 2;
+            Ranging* const shared = &ranging;
+            ranging.parts.fetch_add(1, ::std::memory_order_relaxed);
+            ranging.executive->post([shared, middle, last] {
+                Split(*shared, middle, last);
+            });
+            last = middle;
+        }
+        (*ranging.body)(first, last);
+        ranging.parts.fetch_sub(1, ::std::memory_order_release);
+    }
+
+    bool Done()
+    {
+        pending.fetch_sub(1, ::std::memory_order_release);
+        return true;
+    }
+
+    bool Run(SamePossessive& procedure)
+    {
+        procedure();
+        procedure.clear();
+        return Done();
+    }
+
+    template <class Typical>
+    bool place(Typical&& object)
+    {
+        if (Current() == this)
+            return workers[Index()].deque.push(static_cast<Typical&&>(object));
+        const Cardinal index = next.fetch_add(1, ::std::memory_order_relaxed) % count;
+        return workers[index].inbox.post(static_cast<Typical&&>(object));
+    }
+
+    void work(Cardinal index)
+    {
+        Current() = this;
+        Index() = index;
+        unsigned idle = 0;
+        while (!stopping.load(::std::memory_order_acquire)) {
+            if (help()) {
+                idle = 0;
+            } else if (++idle > 64) {
+                ::std::this_thread::sleep_for(::std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    const Cardinal count; /**< Number of workers. */
+
+    unsigned char* const memory; /**< Worker storage, allocated once. */
+
+    Worker* const workers; /**< Worker states, aligned within memory. */
+
+    alignas(CacheLine) ::std::atomic<Cardinal> next; /**< Next inbox for outside posts. */
+
+    alignas(CacheLine) ::std::atomic<Cardinal> pending; /**< Posted procedures not yet called. */
+
+    alignas(CacheLine) ::std::atomic<bool> stopping; /**< Set when workers must stop. */
+};
+
+/**
+ * @brief
+ *     Read mostly procedure registry which publishes immutable snapshots.
+ * @details
+ *     This type is used to call every registered procedure from any number
+ *     of reader threads, while procedures are added or removed rarely.  A
+ *     call is a single acquire load of the current snapshot followed by 
+ *     plain reads, so readers write nothing shared.  Writers are serialized
+ *     and copy the current snapshot to a free one, then publish it, which 
+ *     retires the previous snapshot at a new epoch.  Retired snapshots are
+ *     reclaimed by quiescent state, once every online reader has called 
+ *     quiesce after their retirement.  Each reader thread owns one of 
+ *     Readers reader indices: it must call quiesce before it first calls
+ *     the registry and regularly afterwards whenever it holds no snapshot, 
+ *     for example once per event loop iteration, and it should call 
+ *     offline before it stops calling the registry for a long time.  A
+ *     writer waits for readers only when every spare snapshot is retired
+ *     and not yet reclaimable.  Procedures are unique by the 
+ *     ComparablyProcedural equal to operator and referenced by address, as
+ *     with Multicasting.
+ * @tparam Capacity
+ *     Maximum number of procedures.
+ * @tparam Readers
+ *     Maximum number of reader threads.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <Cardinal Capacity, Cardinal Readers, class Resultant, class... Parametric>
+class Publishing {
+
+    static_assert(
+        Readers > 0,
+        "Readers: At least one reader required");
+
+public:
+    /**
+     * @brief
+     *     Comparable procedural class type template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an empty registry with every reader offline.
+     */
+    Publishing()
+        : current(&snapshots[0])
+        , epoch(1)
+        , writing(false)
+    {
+        for (Cardinal index = 0; index < Versions; index++) {
+            snapshots[index].count = 0;
+            snapshots[index].retired = 0;
+        }
+        for (Cardinal index = 0; index < Readers; index++)
+            readers[index].quiescent.store(Offline, ::std::memory_order_relaxed);
+    }
+
+    Publishing(const Publishing&) = delete;
+
+    Publishing& operator=(const Publishing&) = delete;
+
+    /**
+     * @brief
+     *     Add a procedure, unless an equal procedure is registered.
+     * @details
+     *     Must not be called by an online reader, for example by a 
+     *     registered procedure during a call, which could wait for itself 
+     *     once every spare snapshot is retired.  Such a reader must defer
+     *     the change until it holds no snapshot and call offline first.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @return
+     *     False only if an equal procedure is registered or it is full.
+     */
+    bool add(const SameProcedural& procedure)
+    {
+        Writing lock(*this);
+        const Snapshot& published = *current.load(::std::memory_order_relaxed);
+        if (published.count >= Capacity || Find(published, procedure) < published.count)
+            return false;
+        Snapshot& copy = spare();
+        for (Cardinal index = 0; index < published.count; index++)
+            copy.procedures[index] = published.procedures[index];
+        copy.procedures[published.count] = &procedure;
+        copy.count = published.count + 1;
+        publish(copy);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Remove the procedure which is equal to the one specified.
+     * @details
+     *     Readers may still call the removed procedure until synchronize 
+     *     returns, so it must outlive that.  Must not be called by an 
+     *     online reader, for the same reason as add.
+     * @param[in] procedure
+     *     Procedure to be compared equal to.
+     * @return
+     *     True only if an equal procedure was removed.
+     */
+    bool remove(const SameProcedural& procedure)
+    {
+        Writing lock(*this);
+        const Snapshot& published = *current.load(::std::memory_order_relaxed);
+        const Cardinal found = Find(published, procedure);
+        if (found >= published.count)
+            return false;
+        Snapshot& copy = spare();
+        Cardinal kept = 0;
+        for (Cardinal index = 0; index < published.count; index++)
+            if (index != found)
+                copy.procedures[kept++] = published.procedures[index];
+        copy.count = kept;
+        publish(copy);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Determine whether an equal procedure is registered.
+     * @details
+     *     Excludes writers, which never reuse the current snapshot, so it 
+     *     may be called by any thread whether or not it is an online reader.
+     * @param[in] procedure
+     *     Procedure to be compared equal to.
+     * @return
+     *     True only if an equal procedure is found.
+     */
+    bool contains(const SameProcedural& procedure) const
+    {
+        Writing lock(*this);
+        const Snapshot& published = *current.load(::std::memory_order_relaxed);
+        return Find(published, procedure) < published.count;
+    }
+
+    /**
+     * @brief
+     *     Number of procedures in the current snapshot.
+     * @details
+     *     Excludes writers like contains, so it may be called by any thread.
+     * @return
+     *     Count of registered procedures.
+     */
+    Cardinal length() const
+    {
+        Writing lock(*this);
+        return current.load(::std::memory_order_relaxed)->count;
+    }
+
+    /**
+     * @brief
+     *     Call each procedure in the current snapshot.
+     * @details
+     *     May be called by a reader thread which is online.  Procedures
+     *     added or removed during the call take effect for later calls.
+     * @param[in] ...arguments
+     *     Argument pack which is passed to each procedure.
+     */
+    void operator()(Parametric... arguments) const
+    {
+        const Snapshot& published = *current.load(::std::memory_order_acquire);
+        for (Cardinal index = 0; index < published.count; index++)
+            (*published.procedures[index])(arguments...);
+    }
+
+    /**
+     * @brief
+     *     Announce that a reader holds no snapshot, and bring it online.
+     * @param[in] reader
+     *     Index of the reader thread, less than Readers.
+     */
+    void quiesce(Cardinal reader)
+    {
+        using namespace std;
+        readers[reader].quiescent.store(epoch.load(memory_order_seq_cst), memory_order_seq_cst);
+    }
+
+    /**
+     * @brief
+     *     Announce that a reader will not call the registry until it next
+     *     calls quiesce.
+     * @param[in] reader
+     *     Index of the reader thread, less than Readers.
+     */
+    void offline(Cardinal reader)
+    {
+        readers[reader].quiescent.store(Offline, ::std::memory_order_release);
+    }
+
+    /**
+     * @brief
+     *     Wait until every online reader has quiesced since the last change.
+     * @details
+     *     Must not be called by an online reader, which could wait for 
+     *     itself.  Procedures removed before the call may then be destroyed.
+     */
+    void synchronize() const
+    {
+        const unsigned long long retired = epoch.load(::std::memory_order_seq_cst);
+        while (!quiesced(retired))
+            ::std::this_thread::yield();
+    }
+
+private:
+    static constexpr Cardinal Versions = 4;
+
+    static constexpr unsigned long long Offline = ~0ULL;
+
+    struct Snapshot {
+        const SameProcedural* procedures[Capacity];
+        Cardinal count;
+        unsigned long long retired;
+    };
+
+    struct alignas(CacheLine) Reader {
+        ::std::atomic<unsigned long long> quiescent;
+    };
+
+    class Writing {
+    public:
+        Writing(const Publishing& registry)
+            : registry(registry)
+        {
+            while (registry.writing.exchange(true, ::std::memory_order_acquire))
+                ::std::this_thread::yield();
+        }
+
+        ~Writing()
+        {
+            registry.writing.store(false, ::std::memory_order_release);
+        }
+
+    private:
+        const Publishing& registry;
+    };
+
+    static Cardinal Find(const Snapshot& snapshot, const SameProcedural& procedure)
+    {
+        Cardinal index = 0;
+        while (index < snapshot.count && !(*snapshot.procedures[index] == procedure))
+            index++;
+        return index;
+    }
+
+    bool quiesced(unsigned long long retired) const
+    {
+        for (Cardinal index = 0; index < Readers; index++)
+            if (readers[index].quiescent.load(::std::memory_order_seq_cst) < retired)
+                return false;
+        return true;
+    }
+
+    Snapshot& spare()
+    {
+        const Snapshot* const published = current.load(::std::memory_order_relaxed);
+        for (;;) {
+            for (Cardinal index = 0; index < Versions; index++) {
+                Snapshot& snapshot = snapshots[index];
+                if (&snapshot != published && quiesced(snapshot.retired))
+                    return snapshot;
+            }
+            ::std::this_thread::yield();
+        }
+    }
+
+    void publish(Snapshot& snapshot)
+    {
+        using namespace std;
+        Snapshot& previous = *current.load(memory_order_relaxed);
+        current.store(&snapshot, memory_order_seq_cst);
+        previous.retired = epoch.fetch_add(1, memory_order_seq_cst) + 1;
+    }
+
+    Snapshot snapshots[Versions]; /**< Current, spare and retired snapshots. */
+
+    Reader readers[Readers]; /**< Quiescent epoch of each reader, or Offline. */
+
+    alignas(CacheLine) ::std::atomic<Snapshot*> current; /**< Published snapshot. */
+
+    ::std::atomic<unsigned long long> epoch; /**< Number of snapshots published plus one. */
+
+    mutable ::std::atomic<bool> writing; /**< Set while a writer is working. */
+};
+
+/**
+ * @brief
+ *     Completion state shared by every asynchronous handle.
+ * @details
+ *     This type is used to wait for an asynchronous call, by spinning for
+ *     Spins checks and then parking on a condition variable, which is only
+ *     notified if a waiter has parked.  Everything is stored inline.
+ */
+class Completing {
+
+public:
+    /**
+     * @brief
+     *     Number of checks made by wait before it parks the thread.
+     */
+    static constexpr Cardinal Spins = 1024;
+
+    Completing(const Completing&) = delete;
+
+    Completing& operator=(const Completing&) = delete;
+
+    /**
+     * @brief
+     *     Determine whether the call has completed.
+     * @return
+     *     True only if the result or the exception of the call is available.
+     */
+    bool ready() const
+    {
+        return state.load(::std::memory_order_acquire) == Complete;
+    }
+
+protected:
+    /**
+     * @brief
+     *     Construct an incomplete state.
+     */
+    Completing()
+        : state(Pending)
+    {
+    }
+
+    /**
+     * @brief
+     *     Spin, then park until the call has completed.
+     */
+    void await() const
+    {
+        using namespace std;
+        for (Cardinal spin = 0; spin < Spins; spin++) {
+            if (state.load(memory_order_acquire) == Complete)
+                return;
+            this_thread::yield();
+        }
+        unique_lock<mutex> lock(guard);
+        unsigned char expected = Pending;
+        if (!state.compare_exchange_strong(expected, Parked, memory_order_acq_rel))
+            return;
+        while (state.load(memory_order_acquire) != Complete)
+            condition.wait(lock);
+    }
+
+    /**
+     * @brief
+     *     Mark the call complete and wake any parked waiter.
+     * @details
+     *     Unless a waiter has parked, the state is not accessed after it is
+     *     marked complete, so the waiter may destroy it as soon as it sees 
+     *     the completion.
+     */
+    void finish()
+    {
+        using namespace std;
+        unsigned char expected = Pending;
+        if (state.compare_exchange_strong(expected, Complete, memory_order_acq_rel))
+            return;
+        lock_guard<mutex> lock(guard);
+        state.store(Complete, memory_order_release);
+        condition.notify_all();
+    }
+
+    /**
+     * @brief
+     *     Address which marks a continuation slot as completed.
+     * @return
+     *     Unique address which is not a procedure.
+     */
+    static const void* Completed()
+    {
+        static const char tag = 0;
+        return &tag;
+    }
+
+private:
+    static constexpr unsigned char Pending = 0; /**< Neither completed nor parked. */
+
+    static constexpr unsigned char Parked = 1; /**< A waiter is parked. */
+
+    static constexpr unsigned char Complete = 2; /**< The result or exception is available. */
+
+    mutable ::std::atomic<unsigned char> state; /**< Pending, Parked or Complete. */
+
+    mutable ::std::mutex guard; /**< Guards parking. */
+
+    mutable ::std::condition_variable condition; /**< Parked waiters. */
+};
+
+/**
+ * @brief
+ *     Caller owned handle of an asynchronous call result.
+ * @details
+ *     This type is used to hold the result of a call made by another 
+ *     thread, using ProcureAsynchronously.  The result slot, the 
+ *     completion flag and the continuation are stored inline, so no 
+ *     allocation is made, and the handle must outlive the call, which the
+ *     destructor ensures by waiting if a call was posted.  A handle is used
+ *     for one call.  If the procedure throws, the exception is stored and 
+ *     rethrown by wait, and any continuation is not called.
+ * @tparam Resultant
+ *     Return type of the call, void or a value type.
+ */
+template <class Resultant>
+class Asynchronous : public Completing {
+
+public:
+    /**
+     * @brief
+     *     Continuation procedural type, called with the result.
+     */
+    using Continuational = Procedural<void, Resultant&>;
+
+    /**
+     * @brief
+     *     Construct a handle with no result.
+     */
+    Asynchronous()
+        : continuation(0)
+        , posted(false)
+        , resolved(false)
+    {
+    }
+
+    /**
+     * @brief
+     *     Wait for any posted call, then destroy any result.
+     */
+    ~Asynchronous()
+    {
+        if (posted)
+            await();
+        if (resolved)
+            reinterpret_cast<Resultant*>(storage)->~Resultant();
+    }
+
+    /**
+     * @brief
+     *     Wait for the result.
+     * @details
+     *     Must only be called once a call has been posted.  Define the 
+     *     macro PROCEDURE_MODULE_NOTHROW to prevent rethrowing the 
+     *     exception of the call.
+     * @return
+     *     Reference to the result, which the handle owns.
+     */
+    Resultant& wait()
+    {
+        await();
+#ifndef PROCEDURE_MODULE_NOTHROW
+        if (failure)
+            ::std::rethrow_exception(failure);
+#endif
+        return *reinterpret_cast<Resultant*>(storage);
+    }
+
+    /**
+     * @brief
+     *     Chain a continuation on the result.
+     * @details
+     *     The continuation is called by the thread which completes the 
+     *     call, or immediately by this thread if it has completed.  It 
+     *     must outlive the call and only one continuation may be chained.
+     *     If the call has already thrown, wait rethrows the exception to 
+     *     this thread instead of calling the continuation.
+     * @param[in] procedure
+     *     Continuation which will be called by reference.
+     */
+    void then(const Continuational& procedure)
+    {
+        using namespace std;
+        const void* expected = 0;
+        if (!continuation.compare_exchange_strong(expected, &procedure, memory_order_acq_rel))
+            procedure(wait());
+    }
+
+    /**
+     * @brief
+     *     Store the result, complete the call and call any continuation.
+     * @tparam ...Propagational
+     *     Types of the arguments of the result constructor.
+     * @param[in] ...arguments
+     *     Arguments of the result constructor.
+     */
+    template <class... Propagational>
+    void resolve(Propagational&&... arguments)
+    {
+        new (storage) Resultant(static_cast<Propagational&&>(arguments)...);
+        resolved = true;
+        const void* const chained = continuation.exchange(Completed(), ::std::memory_order_acq_rel);
+        if (chained)
+            (*static_cast<const Continuational*>(chained))(*reinterpret_cast<Resultant*>(storage));
+        finish();
+    }
+
+#ifndef PROCEDURE_MODULE_NOTHROW
+    /**
+     * @brief
+     *     Store the exception of the call and complete it, without calling
+     *     any continuation which has not been called.
+     * @param[in] exception
+     *     Exception which wait rethrows.
+     */
+    void reject(::std::exception_ptr exception)
+    {
+        failure = exception;
+        continuation.exchange(Completed(), ::std::memory_order_acq_rel);
+        finish();
+    }
+#endif
+
+    /**
+     * @brief
+     *     Record that a call has been posted, which the destructor waits for.
+     */
+    void pend()
+    {
+        posted = true;
+    }
+
+private:
+    alignas(Resultant) unsigned char storage[sizeof(Resultant)]; /**< Result slot. */
+
+    ::std::atomic<const void*> continuation; /**< Chained continuation, or Completed. */
+
+    bool posted; /**< Set once a call is posted. */
+
+    bool resolved; /**< Set once the result is constructed. */
+
+#ifndef PROCEDURE_MODULE_NOTHROW
+    ::std::exception_ptr failure; /**< Exception of the call, or null. */
+#endif
+};
+
+/**
+ * @brief
+ *     Caller owned handle of an asynchronous call without a result.
+ */
+template <>
+class Asynchronous<void> : public Completing {
+
+public:
+    /**
+     * @brief
+     *     Continuation procedural type.
+     */
+    using Continuational = Procedural<void>;
+
+    /**
+     * @brief
+     *     Construct a handle of an incomplete call.
+     */
+    Asynchronous()
+        : continuation(0)
+        , posted(false)
+    {
+    }
+
+    /**
+     * @brief
+     *     Wait for any posted call.
+     */
+    ~Asynchronous()
+    {
+        if (posted)
+            await();
+    }
+
+    /**
+     * @brief
+     *     Wait for the call to complete.
+     * @details
+     *     Must only be called once a call has been posted.  Define the 
+     *     macro PROCEDURE_MODULE_NOTHROW to prevent rethrowing the 
+     *     exception of the call.
+     */
+    void wait()
+    {
+        await();
+#ifndef PROCEDURE_MODULE_NOTHROW
+        if (failure)
+            ::std::rethrow_exception(failure);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Chain a continuation on the completion.
+     * @details
+     *     As for a result, except that the continuation has no parameter.
+     * @param[in] procedure
+     *     Continuation which will be called by reference.
+     */
+    void then(const Continuational& procedure)
+    {
+        using namespace std;
+        const void* expected = 0;
+        if (!continuation.compare_exchange_strong(expected, &procedure, memory_order_acq_rel)) {
+            wait();
+            procedure();
+        }
+    }
+
+    /**
+     * @brief
+     *     Complete the call and call any continuation.
+     */
+    void resolve()
+    {
+        const void* const chained = continuation.exchange(Completed(), ::std::memory_order_acq_rel);
+        if (chained)
+            (*static_cast<const Continuational*>(chained))();
+        finish();
+    }
+
+#ifndef PROCEDURE_MODULE_NOTHROW
+    /**
+     * @brief
+     *     Store the exception of the call and complete it, without calling
+     *     any continuation which has not been called.
+     * @param[in] exception
+     *     Exception which wait rethrows.
+     */
+    void reject(::std::exception_ptr exception)
+    {
+        failure = exception;
+        continuation.exchange(Completed(), ::std::memory_order_acq_rel);
+        finish();
+    }
+#endif
+
+    /**
+     * @brief
+     *     Record that a call has been posted, which the destructor waits for.
+     */
+    void pend()
+    {
+        posted = true;
+    }
+
+private:
+    ::std::atomic<const void*> continuation; /**< Chained continuation, or Completed. */
+
+    bool posted; /**< Set once a call is posted. */
+
+#ifndef PROCEDURE_MODULE_NOTHROW
+    ::std::exception_ptr failure; /**< Exception of the call, or null. */
+#endif
+};
+
+/**
+ * @brief
+ *     Posted call of an asynchronous procedure.
+ * @details
+ *     This type is posted to an executor by ProcureAsynchronously, with 
+ *     the arguments stored by value, and resolves the handle with the 
+ *     result, or rejects it with the exception of the call.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+struct AsynchronouslyPosted {
+
+    /**
+     * @brief
+     *     Stored argument type.
+     */
+    using Arguments = Bound<typename Unreferenced<Parametric>::Type...>;
+
+    /**
+     * @brief
+     *     Call the procedure and resolve the handle with it's result.
+     */
+    void operator()()
+    {
+#ifndef PROCEDURE_MODULE_NOTHROW
+        try {
+            handle->resolve(arguments.template consume<Resultant>(*procedure));
+        } catch (...) {
+            handle->reject(::std::current_exception());
+        }
+#else
+        handle->resolve(arguments.template consume<Resultant>(*procedure));
+#endif
+    }
+
+    Asynchronous<Resultant>* handle; /**< Handle of the result. */
+
+    const Procedural<Resultant, Parametric...>* procedure; /**< Procedure to call. */
+
+    Arguments arguments; /**< Arguments, moved into the call. */
+};
+
+/**
+ * @brief
+ *     Posted call of an asynchronous procedure without a result.
+ */
+template <class... Parametric>
+struct AsynchronouslyPosted<void, Parametric...> {
+
+    /**
+     * @brief
+     *     Stored argument type.
+     */
+    using Arguments = Bound<typename Unreferenced<Parametric>::Type...>;
+
+    /**
+     * @brief
+     *     Call the procedure and resolve the handle.
+     */
+    void operator()()
+    {
+#ifndef PROCEDURE_MODULE_NOTHROW
+        try {
+            arguments.template consume<void>(*procedure);
+            handle->resolve();
+        } catch (...) {
+            handle->reject(::std::current_exception());
+        }
+#else
+        arguments.template consume<void>(*procedure);
+        handle->resolve();
+#endif
+    }
+
+    Asynchronous<void>* handle; /**< Handle of the completion. */
+
+    const Procedural<void, Parametric...>* procedure; /**< Procedure to call. */
+
+    Arguments arguments; /**< Arguments, moved into the call. */
+};
+
+/**
+ * @brief
+ *     Call a procedure on an executor, holding the result in a handle.
+ * @details
+ *     The call and a copy of the arguments are posted to the executor as a
+ *     Possessive, so they must fit it's capacity, and the result is stored
+ *     in the caller owned handle, so no allocation is made.  The procedure
+ *     must outlive the call.  If the executor has no room, the call is 
+ *     made immediately by this thread.  If posting throws an exception, 
+ *     the handle is left unused and the exception is rethrown.
+ * @tparam Length
+ *     Number of slots in each deque and inbox of the executor.
+ * @tparam Capacity
+ *     Size in bytes of the Possessive inline storage of the executor.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @tparam ...Propagational
+ *     Argument types, deduced as forwarding references.
+ * @param[in] executive
+ *     Executor which will make the call.
+ * @param[in] handle
+ *     Unused handle which will hold the result or the exception of the call.
+ * @param[in] procedure
+ *     Procedure which will be called by reference.
+ * @param[in] ...arguments
+ *     Arguments which are copied if they are lvalues, otherwise moved, 
+ *     and which must be copy constructible like any Possessive.
+ */
+template <Cardinal Length, Cardinal Capacity, class Resultant, class... Parametric, class... Propagational>
+static void ProcureAsynchronously(
+    Executive<Length, Capacity>&
+        executive,
+    Asynchronous<Resultant>&
+        handle,
+    const Procedural<Resultant, Parametric...>&
+        procedure,
+    Propagational&&...
+        arguments)
+{
+    using Posted = AsynchronouslyPosted<Resultant, Parametric...>;
+    using Arguments = typename Posted::Arguments;
+    using Sequencial = typename Arguments::BaseBinding::Sequencial;
+    executive.post(Posted{ &handle, &procedure, Arguments(Sequencial(), static_cast<Propagational&&>(arguments)...) });
+    handle.pend();
+}
+#endif
+}
+
+#endif
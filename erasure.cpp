@@ -1,7 +1,6 @@
-//  2019 Aaron Sami Abassi
+// © 2019 Aaron Sami Abassi
 // Licensed under the Academic Free License version 3.0
 // #define PROCEDURE_MODULE_NOTHROW
-// #define PROCEDURE_MODULE_NORTTI
 // #define PROCEDURE_MODULE_NOSTDCPP
 #include "procedure.hpp"
 #include <iostream>
@@ -39,7 +38,7 @@ public:
     {
         return *procedure;
     }
-    constexpr bool operator==(const BaseProcedural& relative) const
+    constexpr bool operator==(const SameProcedural& relative) const
     {
         return *procedure == relative;
     }
@@ -93,10 +92,10 @@ int main()
     PerformCalls(calls);
     ShuffleCalls(calls);
     cout << endl;
-    cout << "Run-time type information (RTTI): ";
-    if (calls[0] == Procure(Lambda, Guide<void>))
-        cout << "is enabled";
+    cout << "Separate procedure instances of the same lambda: ";
+    if (calls[0] == ProcureComparably(Lambda, Guide<void>))
+        cout << "are equal";
     else
-        cout << "is disabled";
+        cout << "are not equal";
     cout << endl;
 }
@@ -1,8 +1,8 @@
-//  2019 Aaron Sami Abassi
+// © 2019 Aaron Sami Abassi
 // Licensed under the Academic Free License version 3.0
 // #define PROCEDURE_MODULE_NOTHROW
-// #define PROCEDURE_MODULE_NORTTI
 // #define PROCEDURE_MODULE_NOSTDCPP
+// #define PROCEDURE_MODULE_NOVIRTUAL
 #include "procedure.hpp"
 #include <iostream>
 
@@ -0,0 +1,12 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+
+using namespace procedure;
+
+// Compile only (see 'run_instantiation.sh')
+void CallInstantiated(const ComparablyProcedural<void, int>&, int);
+
+#define INSTANTIATION_CALL CallInstantiated
+#define INSTANTIATION_PRODUCE(object) ProcureComparably(ProcureThinly(object, Guide<void, int>))
+#include "instantiation.conditions"
@@ -0,0 +1,10 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include <functional>
+
+// Compile only (see 'run_instantiation.sh')
+void CallInstantiated(const std::function<void(int)>&, int);
+
+#define INSTANTIATION_CALL CallInstantiated
+#define INSTANTIATION_PRODUCE(object) std::function<void(int)>(object)
+#include "instantiation.conditions"
@@ -0,0 +1,315 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef PROCEDURE_INSTRUMENTED_MODULE
+#define PROCEDURE_INSTRUMENTED_MODULE
+#include "concurrent.hpp"
+
+/**
+ * @brief   
+ *     Procedure call instrumentation.
+ * @details 
+ *     Allows the calls of any procedure to be counted and timed without 
+ *     modifying the callable object.  Counts are kept in relaxed atomics,
+ *     optionally sharded per thread, and can be read at any time as a 
+ *     plain snapshot.  Define the macro PROCEDURE_MODULE_NOINSTRUMENT to
+ *     compile the instrumentation to nothing, where calls are forwarded 
+ *     and snapshots are empty.  Like concurrent.hpp this header is not 
+ *     available when the macro PROCEDURE_MODULE_NOSTDCPP is required.
+ */
+namespace procedure {
+
+/**
+ * @brief
+ *     Number of latency histogram buckets.
+ * @details
+ *     Bucket zero counts calls of less than one nanosecond and bucket N 
+ *     counts calls of at least 2^(N-1) and less than 2^N nanoseconds, 
+ *     except that the last bucket also counts every longer call.
+ */
+constexpr Cardinal InstrumentBuckets = 40;
+
+/**
+ * @brief
+ *     Plain snapshot of the instrumentation of a procedure.
+ * @details
+ *     This type is trivially copyable so that it can be exported or 
+ *     scraped by any means.
+ */
+struct Instrumentation {
+    unsigned long long calls; /**< Number of calls. */
+    unsigned long long nanoseconds; /**< Sum of call latencies. */
+    unsigned long long buckets[InstrumentBuckets]; /**< Latency histogram. */
+};
+
+/**
+ * @brief
+ *     Class for counting and timing the calls of a procedure.
+ * @details
+ *     This type is used to call a procedure and record the call count, the
+ *     total latency and a log bucketed latency histogram.  Counters are 
+ *     relaxed atomics which are aligned to a cache line in each of Shards 
+ *     shards, and each thread records into one shard, so that threads 
+ *     calling the same procedure need not contend.  The procedure is 
+ *     stored by value, or referenced if Specific is a reference type.  A
+ *     copy has the same procedure and no recorded calls.
+ * @tparam Specific
+ *     Type of the procedure, or a reference to a Procedural type.
+ * @tparam Shards
+ *     Number of counter shards.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Specific, Cardinal Shards, class Resultant, class... Parametric>
+class Instrumented : public Procedural<Resultant, Parametric...> {
+
+    static_assert(
+        Shards > 0,
+        "Shards: At least one shard required");
+
+public:
+    /**
+     * @brief
+     *     Construct an instrumented procedure.
+     * @param[in] procedure
+     *     The procedure which will be called.
+     */
+    Instrumented(const typename Unreferenced<Specific>::Type& procedure)
+        : Procedural<Resultant, Parametric...>(this)
+        , procedure(procedure)
+    {
+        reset();
+    }
+
+    /**
+     * @brief
+     *     Construct a copy with no recorded calls.
+     * @param[in] copy
+     *     The instance of this class whose procedure is copied.
+     */
+    Instrumented(const Instrumented& copy)
+        : Procedural<Resultant, Parametric...>(this)
+        , procedure(copy.procedure)
+    {
+        reset();
+    }
+
+    /** 
+     * @brief         
+     *     Procedural call operator.
+     * @details       
+     *     Implements the procedural call operator by timing the call of the
+     *     procedure, recording it and returning it's result to the calling
+     *     context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+#ifdef PROCEDURE_MODULE_NOINSTRUMENT
+        return procedure(static_cast<Parametric&&>(arguments)...);
+#else
+        const Recording recording(shards[Shards > 1 ? Shard() % Shards : 0]);
+        return procedure(static_cast<Parametric&&>(arguments)...);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Snapshot of the recorded calls.
+     * @details
+     *     Sums every shard.  Calls which are in progress or concurrent with
+     *     the snapshot may be only partly included.
+     * @return
+     *     The instrumentation of every completed call.
+     */
+    Instrumentation snapshot() const
+    {
+        Instrumentation result = {};
+#ifndef PROCEDURE_MODULE_NOINSTRUMENT
+        using namespace std;
+        for (const Counting& shard : shards) {
+            result.calls += shard.calls.load(memory_order_relaxed);
+            result.nanoseconds += shard.nanoseconds.load(memory_order_relaxed);
+            for (Cardinal bucket = 0; bucket < InstrumentBuckets; bucket++)
+                result.buckets[bucket] += shard.buckets[bucket].load(memory_order_relaxed);
+        }
+#endif
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Discard the recorded calls.
+     */
+    void reset()
+    {
+#ifndef PROCEDURE_MODULE_NOINSTRUMENT
+        using namespace std;
+        for (Counting& shard : shards) {
+            shard.calls.store(0, memory_order_relaxed);
+            shard.nanoseconds.store(0, memory_order_relaxed);
+            for (Cardinal bucket = 0; bucket < InstrumentBuckets; bucket++)
+                shard.buckets[bucket].store(0, memory_order_relaxed);
+        }
+#endif
+    }
+
+private:
+#ifndef PROCEDURE_MODULE_NOINSTRUMENT
+    struct alignas(CacheLine) Counting {
+        ::std::atomic<unsigned long long> calls;
+        ::std::atomic<unsigned long long> nanoseconds;
+        ::std::atomic<unsigned long long> buckets[InstrumentBuckets];
+    };
+
+    // Records the latency of the enclosing call when destroyed, so that a
+    // call which returns a value or throws is also recorded
+    class Recording {
+
+    public:
+        Recording(Counting& shard)
+            : shard(shard)
+            , start(::std::chrono::steady_clock::now())
+        {
+        }
+
+        ~Recording()
+        {
+            using namespace std;
+            using namespace std::chrono;
+            const auto finish = steady_clock::now();
+            const unsigned long long latency = duration_cast<nanoseconds>(finish - start).count();
+            Cardinal bucket = 0;
+            for (unsigned long long remaining = latency; remaining && bucket < InstrumentBuckets - 1; remaining >>= 1)
+                bucket++;
+            shard.calls.fetch_add(1, memory_order_relaxed);
+            shard.nanoseconds.fetch_add(latency, memory_order_relaxed);
+            shard.buckets[bucket].fetch_add(1, memory_order_relaxed);
+        }
+
+    private:
+        Counting& shard;
+
+        const ::std::chrono::steady_clock::time_point start;
+    };
+
+    static Cardinal Shard()
+    {
+        static ::std::atomic<Cardinal> next(0);
+        static thread_local const Cardinal shard = next.fetch_add(1, ::std::memory_order_relaxed);
+        return shard;
+    }
+
+    mutable Counting shards[Shards]; /**< Per thread counters. */
+#endif
+
+    Specific procedure; /**< Instrumented procedure. */
+};
+
+/**
+ * @brief         
+ *     Instrument any procedure by reference.
+ * @details       
+ *     This function template is used to instrument any existing procedure,
+ *     which must outlive the result.
+ * @tparam Shards
+ *     Number of counter shards, one unless specified.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] procedure
+ *     Reference to the procedure which will be called.
+ * @return
+ *     Instrumented procedure which references procedure.
+ */
+template <Cardinal Shards = 1, class Resultant, class... Parametric>
+static Instrumented<const Procedural<Resultant, Parametric...>&, Shards, Resultant, Parametric...>
+Instrument(
+    const Procedural<Resultant, Parametric...>&
+        procedure)
+{
+    using Specific = Instrumented<const Procedural<Resultant, Parametric...>&, Shards, Resultant, Parametric...>;
+    return Specific(procedure);
+}
+
+/**
+ * @brief         
+ *     Specify a callable object as an instrumented procedural call object.
+ * @details       
+ *     This function template takes the same arguments as Procure and
+ *     stores the resulting procedure by value.
+ * @tparam Shards
+ *     Number of counter shards, one unless specified.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Instrumented procedure which references object.
+ */
+template <Cardinal Shards = 1, class Typical, class Resultant, class... Parametric>
+static Instrumented<SimplyObjective<Typical, Resultant, Parametric...>, Shards, Resultant, Parametric...>
+ProcureInstrumentally(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = Instrumented<SimplyObjective<Typical, Resultant, Parametric...>, Shards, Resultant, Parametric...>;
+    return Specific(Procure(object, guide));
+}
+
+/**
+ * @brief         
+ *     Specify an object member function as an instrumented procedural call
+ *     object.
+ * @details       
+ *     This function template takes the same arguments as Procure and
+ *     stores the resulting procedure by value.
+ * @tparam Shards
+ *     Number of counter shards, one unless specified.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] method
+ *     Pointer to the member function which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Instrumented procedure which references object and method.
+ */
+template <Cardinal Shards = 1, class Typical, class MethodLocational, class Resultant, class... Parametric>
+static Instrumented<SimplyMethodic<Typical, MethodLocational, Resultant, Parametric...>, Shards, Resultant, Parametric...>
+ProcureInstrumentally(
+    Typical&
+        object,
+    const MethodLocational
+        method,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = Instrumented<SimplyMethodic<Typical, MethodLocational, Resultant, Parametric...>, Shards, Resultant, Parametric...>;
+    return Specific(Procure(object, method, guide));
+}
+
+}
+
+#endif
@@ -0,0 +1,234 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef PROCEDURE_MEMOIZED_MODULE
+#define PROCEDURE_MEMOIZED_MODULE
+#include "procedure.hpp"
+#include <atomic>
+#include <functional>
+#include <type_traits>
+
+/**
+ * @brief
+ *     Procedure result memoization.
+ * @details
+ *     Allows the results of a pure procedure of one parameter to be cached
+ *     by argument, behind the same Procedural interface, so that repeated
+ *     calls skip the real work.  Keys are hashed with the standard hash, so
+ *     like concurrent.hpp this header is not available when the macro
+ *     PROCEDURE_MODULE_NOSTDCPP is required.
+ */
+namespace procedure {
+
+/**
+ * @brief
+ *     Class for caching the results of a pure procedure.
+ * @details
+ *     This type is used to call a procedure of one parameter only when its
+ *     argument is not cached, in a bounded open addressing table of
+ *     Capacity entries.  A key is looked up in the Probes consecutive
+ *     entries from its hashed index, and a miss replaces the least
+ *     recently used of them, so one probe is a direct mapped cache and more
+ *     probes are a set associative cache.  The table is a member which is
+ *     not thread safe unless Local is true, in which case each thread has
+ *     its own table per Memoized type, so calls from any thread need no
+ *     lock.  Its entries are tagged with an identity unique to each
+ *     instance, which clear replaces, so instances of the same type share
+ *     the capacity of each thread's table.  The procedure is stored by
+ *     value, or referenced if Specific is a reference type.  A copy has the
+ *     same procedure and an empty cache.  The key and result are stored
+ *     decayed, which must be default constructible and copy assignable,
+ *     and the key must be equality comparable.
+ * @tparam Specific
+ *     Type of the procedure, or a reference to a Procedural type.
+ * @tparam Capacity
+ *     Number of table entries, a power of two.
+ * @tparam Probes
+ *     Number of entries a key may occupy, from one to Capacity.
+ * @tparam Local
+ *     True for a table per thread, otherwise a table per instance.
+ * @tparam Resultant
+ *     Return type of the call, which must not be void or a reference.
+ * @tparam Key
+ *     Parameter type of the call.
+ */
+template <class Specific, Cardinal Capacity, Cardinal Probes, bool Local, class Resultant, class Key>
+class Memoized : public Procedural<Resultant, Key> {
+
+    static_assert(
+        Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+        "Capacity: Power of two required");
+
+    static_assert(
+        Probes > 0 && Probes <= Capacity,
+        "Probes: From one to Capacity required");
+
+    static_assert(
+        !::std::is_void<Resultant>::value && !::std::is_reference<Resultant>::value,
+        "Resultant: Non void value type required");
+
+public:
+    /**
+     * @brief
+     *     Decayed key type which is stored.
+     */
+    using Keyed = typename ::std::decay<Key>::type;
+
+    /**
+     * @brief
+     *     Construct a memoized procedure.
+     * @param[in] procedure
+     *     The procedure which will be called for uncached keys.
+     */
+    Memoized(const typename Unreferenced<Specific>::Type& procedure)
+        : Procedural<Resultant, Key>(this)
+        , procedure(procedure)
+        , identity(Identify())
+        , table()
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a copy with the same procedure and an empty cache.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    Memoized(const Memoized& copy)
+        : Procedural<Resultant, Key>(this)
+        , procedure(copy.procedure)
+        , identity(Identify())
+        , table()
+    {
+    }
+
+    /**
+     * @brief
+     *     Procedural call operator.
+     * @details
+     *     Returns the cached result for key, otherwise calls the procedure,
+     *     caches it's result and returns it.  The procedure may call this
+     *     procedure recursively.
+     * @param[in] key
+     *     Argument which is forwarded on a miss.
+     * @return
+     *     The cached or returned result of the call.
+     */
+    Resultant operator()(Key key) const PROCEDURE_MODULE_FINAL
+    {
+        Table& cache = Cache(table);
+        const unsigned long long tag = identity.load(::std::memory_order_relaxed);
+        const Cardinal home = Index(key);
+        Entry* victim = &cache.entries[home];
+        for (Cardinal probe = 0; probe < Probes; probe++) {
+            Entry& entry = cache.entries[(home + probe) & (Capacity - 1)];
+            if (entry.identity == tag && entry.key == key) {
+                entry.stamp = ++cache.clock;
+                return entry.result;
+            }
+            if (entry.stamp < victim->stamp)
+                victim = &entry;
+        }
+        Keyed stored(key);
+        Resultant result = procedure(static_cast<Key&&>(key));
+        victim->key = static_cast<Keyed&&>(stored);
+        victim->result = result;
+        victim->identity = tag;
+        victim->stamp = ++cache.clock;
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Discard every cached result of this instance.
+     * @details
+     *     Takes constant time, by replacing the identity which entries are
+     *     tagged with, so that with a table per thread the results cached
+     *     by every thread are discarded.
+     */
+    void clear()
+    {
+        identity.store(Identify(), ::std::memory_order_relaxed);
+    }
+
+private:
+    struct Entry {
+        Keyed key;
+        Resultant result;
+        unsigned long long identity;
+        unsigned long long stamp;
+    };
+
+    struct Table {
+        Entry entries[Capacity];
+        unsigned long long clock;
+    };
+
+    static unsigned long long Identify()
+    {
+        static ::std::atomic<unsigned long long> next(1);
+        return next.fetch_add(1, ::std::memory_order_relaxed);
+    }
+
+    static Cardinal Index(const Keyed& key)
+    {
+        // Fibonacci hashing spreads standard hashes which are identities
+        const unsigned long long hash = ::std::hash<Keyed>()(key);
+        return static_cast<Cardinal>((hash * 0x9E3779B97F4A7C15ULL) >> 32) & (Capacity - 1);
+    }
+
+    struct Vacant {
+    };
+
+    static Table& Cache(Table& table)
+    {
+        return table;
+    }
+
+    static Table& Cache(Vacant&)
+    {
+        static thread_local Table table = {};
+        return table;
+    }
+
+    Specific procedure; /**< Memoized procedure. */
+
+    ::std::atomic<unsigned long long> identity; /**< Tag of the entries of this instance. */
+
+    mutable typename ::std::conditional<Local, Vacant, Table>::type table; /**< Cache of this instance, unless Local. */
+};
+
+/**
+ * @brief
+ *     Memoize any procedure of one parameter by reference.
+ * @details
+ *     This function template is used to cache the results of any existing
+ *     pure procedure, such as the result of Procure, which must outlive
+ *     the result.
+ * @tparam Capacity
+ *     Number of table entries, a power of two.
+ * @tparam Probes
+ *     Number of entries a key may occupy, four unless specified.
+ * @tparam Local
+ *     True for a table per thread, false unless specified.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam Key
+ *     Parameter type of the call.
+ * @param[in] procedure
+ *     Reference to the procedure which will be called.
+ * @return
+ *     Memoized procedure which references procedure.
+ */
+template <Cardinal Capacity, Cardinal Probes = 4, bool Local = false, class Resultant, class Key>
+static Memoized<const Procedural<Resultant, Key>&, Capacity, Probes, Local, Resultant, Key>
+Memoize(
+    const Procedural<Resultant, Key>&
+        procedure)
+{
+    using Specific = Memoized<const Procedural<Resultant, Key>&, Capacity, Probes, Local, Resultant, Key>;
+    return Specific(procedure);
+}
+
+}
+
+#endif
@@ -1,10 +1,17 @@
-//  2019 Aaron Sami Abassi
+// © 2019 Aaron Sami Abassi
 // Licensed under the Academic Free License version 3.0
 #ifndef PROCEDURE_MODULE
 #define PROCEDURE_MODULE
 #ifndef PROCEDURE_MODULE_NOSTDCPP
+#include <functional>
+#include <new>
 #include <type_traits>
 #endif
+#ifdef PROCEDURE_MODULE_NOVIRTUAL
+#define PROCEDURE_MODULE_FINAL
+#else
+#define PROCEDURE_MODULE_FINAL final
+#endif
 
 /**
  * @brief   
@@ -12,12 +19,11 @@
  * @details 
  *     Allows any C++ procedure to be called using one common interface.
  *     This includes functions, lambdas, call operators on user defined types
- *     as well as member functions with object context.  **When using the
- *     comparable classes without run-time type information (RTTI) support,
- *     comparison will only work if each unique procedure site is only 
- *     represented by one procedural object instance**.  With RTTI support there
- *     can be many procedural instances for each procedure, where the
- *     object address spaces of the procedures are compared directly.
+ *     as well as member functions with object context.  Comparable 
+ *     procedures are compared by value, using a type identity tag and the
+ *     object and member function addresses, so there can be many procedural
+ *     instances for each procedure with or without run-time type 
+ *     information (RTTI) support.
  */
 namespace procedure {
 
@@ -36,13 +42,270 @@ namespace procedure {
 template <class Resultant, class... Parametric>
 using Functional = Resultant(Parametric...);
 
+/**
+ * @brief
+ *     Unsigned size type.
+ * @details
+ *     This type is the result type of the sizeof operator, which is used in
+ *     place of the standard library size type so that no header is required.
+ */
+using Cardinal = decltype(sizeof(0));
+
+/**
+ * @brief
+ *     Reference removal type.
+ * @details
+ *     This class template provides the referred to type of a reference type
+ *     as the Type member, or the type itself if it is not a reference type.
+ *     It is used in place of the standard library type traits so that no 
+ *     header is required.
+ * @tparam Typical
+ *     Type which may be a reference type.
+ */
+template <class Typical>
+struct Unreferenced {
+    using Type = Typical; /**< Referred to type. */
+};
+
+/**
+ * @brief
+ *     Reference removal type specialized for lvalue references.
+ * @tparam Typical
+ *     Referred to type.
+ */
+template <class Typical>
+struct Unreferenced<Typical&> {
+    using Type = Typical; /**< Referred to type. */
+};
+
+/**
+ * @brief
+ *     Reference removal type specialized for rvalue references.
+ * @tparam Typical
+ *     Referred to type.
+ */
+template <class Typical>
+struct Unreferenced<Typical&&> {
+    using Type = Typical; /**< Referred to type. */
+};
+
+/**
+ * @brief
+ *     Qualifier removal type.
+ * @details
+ *     This class template provides the type without its top level const 
+ *     and volatile qualifiers as the Type member.
+ * @tparam Typical
+ *     Type which may be qualified.
+ */
+template <class Typical>
+struct Unqualified {
+    using Type = Typical; /**< Unqualified type. */
+};
+
+/**
+ * @brief
+ *     Qualifier removal type specialized for const types.
+ * @tparam Typical
+ *     Unqualified type.
+ */
+template <class Typical>
+struct Unqualified<const Typical> {
+    using Type = Typical; /**< Unqualified type. */
+};
+
+/**
+ * @brief
+ *     Qualifier removal type specialized for volatile types.
+ * @tparam Typical
+ *     Unqualified type.
+ */
+template <class Typical>
+struct Unqualified<volatile Typical> {
+    using Type = Typical; /**< Unqualified type. */
+};
+
+/**
+ * @brief
+ *     Qualifier removal type specialized for const volatile types.
+ * @tparam Typical
+ *     Unqualified type.
+ */
+template <class Typical>
+struct Unqualified<const volatile Typical> {
+    using Type = Typical; /**< Unqualified type. */
+};
+
+/**
+ * @brief
+ *     Decayed type.
+ * @details
+ *     This class template provides the type which a value of the given 
+ *     type is stored as when passed by value, as the Type member.  The 
+ *     reference and top level qualifiers are removed, arrays become 
+ *     pointers to their elements and functions become function pointers.
+ *     It is used in place of the standard library type traits so that no
+ *     header is required.
+ * @tparam Typical
+ *     Type which may be a reference, qualified, array or function type.
+ */
+template <class Typical>
+struct Decayed {
+    using Type = typename Unqualified<Typical>::Type; /**< Decayed type. */
+};
+
+/**
+ * @brief
+ *     Decayed type specialized for lvalue references.
+ * @tparam Typical
+ *     Referred to type.
+ */
+template <class Typical>
+struct Decayed<Typical&> {
+    using Type = typename Decayed<Typical>::Type; /**< Decayed type. */
+};
+
+/**
+ * @brief
+ *     Decayed type specialized for rvalue references.
+ * @tparam Typical
+ *     Referred to type.
+ */
+template <class Typical>
+struct Decayed<Typical&&> {
+    using Type = typename Decayed<Typical>::Type; /**< Decayed type. */
+};
+
+/**
+ * @brief
+ *     Decayed type specialized for arrays.
+ * @tparam Typical
+ *     Element type.
+ * @tparam length
+ *     Number of elements.
+ */
+template <class Typical, Cardinal length>
+struct Decayed<Typical[length]> {
+    using Type = Typical*; /**< Decayed type. */
+};
+
+/**
+ * @brief
+ *     Decayed type specialized for arrays of unknown bound.
+ * @tparam Typical
+ *     Element type.
+ */
+template <class Typical>
+struct Decayed<Typical[]> {
+    using Type = Typical*; /**< Decayed type. */
+};
+
+/**
+ * @brief
+ *     Decayed type specialized for functions.
+ * @tparam Resultant
+ *     Return type of the function.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types.
+ */
+template <class Resultant, class... Parametric>
+struct Decayed<Resultant(Parametric...)> {
+    using Type = Resultant (*)(Parametric...); /**< Decayed type. */
+};
+
+#ifdef __cpp_noexcept_function_type
+/**
+ * @brief
+ *     Decayed type specialized for functions which do not throw.
+ * @tparam Resultant
+ *     Return type of the function.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types.
+ */
+template <class Resultant, class... Parametric>
+struct Decayed<Resultant(Parametric...) noexcept> {
+    using Type = Resultant (*)(Parametric...) noexcept; /**< Decayed type. */
+};
+#endif
+
+/**
+ * @brief
+ *     Initial value of a digest.
+ * @details
+ *     This is the FNV-1a offset basis for the width of Cardinal.
+ */
+constexpr Cardinal DigestBasis = sizeof(Cardinal) > 4 ? Cardinal(14695981039346656037ULL) : Cardinal(2166136261UL);
+
+/**
+ * @brief
+ *     Multiplier of a digest.
+ * @details
+ *     This is the FNV-1a prime for the width of Cardinal.
+ */
+constexpr Cardinal DigestPrime = sizeof(Cardinal) > 4 ? Cardinal(1099511628211ULL) : Cardinal(16777619UL);
+
+/**
+ * @brief
+ *     Digest the bytes of an object representation.
+ * @details
+ *     This function uses the FNV-1a hash function and can be chained by 
+ *     passing the result of one call as the digest of the next.
+ * @param[in] location
+ *     Address of the first byte.
+ * @param[in] length
+ *     Number of bytes.
+ * @param[in] digest
+ *     Digest of any preceding bytes.
+ * @return
+ *     Digest of the preceding and specified bytes.
+ */
+static inline Cardinal Digest(const void* location, Cardinal length, Cardinal digest = DigestBasis)
+{
+    const unsigned char* byte = static_cast<const unsigned char*>(location);
+    for (Cardinal index = 0; index < length; index++)
+        digest = (digest ^ byte[index]) * DigestPrime;
+    return digest;
+}
+
+/**
+ * @brief
+ *     Collate the bytes of two object representations.
+ * @details
+ *     This function compares bytes in order until they differ, which is a
+ *     total order of equal length representations that is consistent with
+ *     their equality.  It is used rather than comparing unrelated pointers
+ *     with the less than operator, which the language leaves unspecified.
+ * @param[in] location
+ *     Address of the first byte of the first representation.
+ * @param[in] relative
+ *     Address of the first byte of the second representation.
+ * @param[in] length
+ *     Number of bytes in each representation.
+ * @return
+ *     Negative, zero or positive if the first representation collates 
+ *     before, the same as or after the second respectively.
+ */
+static inline int Collate(const void* location, const void* relative, Cardinal length)
+{
+    const unsigned char* byte = static_cast<const unsigned char*>(location);
+    const unsigned char* other = static_cast<const unsigned char*>(relative);
+    for (Cardinal index = 0; index < length; index++)
+        if (byte[index] != other[index])
+            return byte[index] < other[index] ? -1 : 1;
+    return 0;
+}
+
 /**
  * @brief         
  *     Abstract procedural base class.
  * @details       
  *     This type is used to call any procedure matching the specified
  *     return and parameter types, using the sole virtual call operator 
- *     member.  Only references and pointers to this type are useful.
+ *     member.  Only references and pointers to this type are useful.  When
+ *     the macro PROCEDURE_MODULE_NOVIRTUAL is defined, the call operator is
+ *     not virtual and instead calls a function pointer to a trampoline of
+ *     the most derived class, which is stored by the constructor, so that
+ *     no virtual table is generated for any procedure.
  * @tparam Resultant
  *     Return type of the call.
  * @tparam ...Parametric
@@ -52,22 +315,124 @@ template <class Resultant, class... Parametric>
 class Procedural {
 
 public:
+#ifdef PROCEDURE_MODULE_NOVIRTUAL
+    /**
+     * @brief
+     *     Trampoline call operator.
+     * @details
+     *     Calls the call operator of the most derived class through the
+     *     stored trampoline.  Arguments are forwarded as they are by the
+     *     virtual call operator, although a parameter declared by value is
+     *     moved once more on the way to the most derived class.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const
+    {
+        return trampoline(*this, static_cast<Parametric&&>(arguments)...);
+    }
+#else
     /**
      * @brief
      *     Pure virtual call operator.
      * @details
      *     This operator must be implemented by classes which are derived
-     *     from this class.
+     *     from this class.  Implementations forward each argument to the
+     *     target, so a parameter declared by value is moved into the target
+     *     rather than copied.  Declare a parameter as an rvalue reference
+     *     (for example Guide<void, Buffer&&>) to pass it through without
+     *     any copy or move construction at all.
      */
     virtual Resultant operator()(Parametric...) const = 0;
+#endif
+
+protected:
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+    /**
+     * @brief
+     *     Construct the procedural base of a virtual derived class.
+     */
+    constexpr Procedural() = default;
+#endif
+
+    /**
+     * @brief
+     *     Construct the procedural base of a most derived class.
+     * @details
+     *     Stores the trampoline of the most derived class when the macro
+     *     PROCEDURE_MODULE_NOVIRTUAL is defined, otherwise does nothing.
+     * @tparam Specific
+     *     Most derived class, which must implement the call operator.
+     */
+    template <class Specific>
+    constexpr Procedural(const Specific*)
+#ifdef PROCEDURE_MODULE_NOVIRTUAL
+        : trampoline(Trampoline<Specific>)
+#endif
+    {
+    }
+
+#ifdef PROCEDURE_MODULE_NOVIRTUAL
+private:
+    /**
+     * @brief
+     *     Trampoline function type.
+     */
+    using Trampolinic = Resultant(const Procedural&, Parametric&&...);
+
+    /**
+     * @brief
+     *     Call the most derived class.
+     * @tparam Specific
+     *     Most derived class.
+     * @param[in] procedure
+     *     Procedural base of the instance to call.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    template <class Specific>
+    static Resultant Trampoline(const Procedural& procedure, Parametric&&... arguments)
+    {
+        return static_cast<const Specific&>(procedure)(static_cast<Parametric&&>(arguments)...);
+    }
+
+    Trampolinic* trampoline; /**< Trampoline of the most derived class. */
+#endif
+};
+
+/**
+ * @brief
+ *     Type identity tag.
+ * @details
+ *     The address of the tag member is unique to each type, which allows 
+ *     types to be identified without run-time type information (RTTI). The
+ *     tag is not constant, so that identical code folding cannot merge the
+ *     tags of different types into one address.
+ * @tparam Specific
+ *     Type which is identified.
+ */
+template <class Specific>
+struct Identical {
+    static char tag; /**< Tag whose address identifies Specific. */
 };
 
+template <class Specific>
+char Identical<Specific>::tag;
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
 /**
  * @brief         
  *     Abstract comparable procedural base class.
  * @details       
  *     This type is used to call or compare procedures matching the 
- *     specified return and parameter types
+ *     specified return and parameter types.  Each most derived class 
+ *     returns its identity tag from a virtual function, so the identity is
+ *     not stored in each instance and a relative instance can still be 
+ *     compared by value without a dynamic cast.
  * @tparam Resultant
  *     Return type of the call.
  * @tparam ...Parametric
@@ -83,14 +448,21 @@ public:
      */
     using BaseProcedural = Procedural<Resultant, Parametric...>;
 
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
     /** 
      * @brief         
      *     Pure virtual equal to operator.
      * @details       
      *     This operator must be implemented by classes which are derived 
-     *     from this class.
+     *     from this class.  Implementations only return true for a relative
+     *     with the same identity.
      */
-    virtual bool operator==(const BaseProcedural&) const = 0;
+    virtual bool operator==(const SameProcedural&) const = 0;
 
     /** 
      * @brief         
@@ -103,11 +475,110 @@ public:
      * @return
      *     The inverse of the equal to operator return value.
      */
-    constexpr bool operator!=(const BaseProcedural& relative) const
+    constexpr bool operator!=(const SameProcedural& relative) const
     {
         return !operator==(relative);
     }
+
+    /**
+     * @brief
+     *     Pure virtual hash function.
+     * @details
+     *     This function must be implemented by classes which are derived 
+     *     from this class.  Implementations must return the same value for 
+     *     procedures which are equal, using the identity and the same 
+     *     fields which the equal to operator compares.
+     * @return
+     *     Hash value of this procedure.
+     */
+    virtual Cardinal hash() const = 0;
+
+    /** 
+     * @brief         
+     *     Pure virtual less than operator.
+     * @details       
+     *     This operator must be implemented by classes which are derived 
+     *     from this class.  Implementations must be a strict weak ordering
+     *     which orders by identity first, using precedes, and which is 
+     *     consistent with the equal to operator.
+     */
+    virtual bool operator<(const SameProcedural&) const = 0;
+
+    /** 
+     * @brief         
+     *     Greater than operator implementation.
+     * @param[in] relative
+     *     Procedural object to be compared greater than.
+     * @return
+     *     True only if relative is less than this.
+     */
+    bool operator>(const SameProcedural& relative) const
+    {
+        return relative < *this;
+    }
+
+    /** 
+     * @brief         
+     *     Less than or equal to operator implementation.
+     * @param[in] relative
+     *     Procedural object to be compared less than or equal to.
+     * @return
+     *     True only if relative is not less than this.
+     */
+    bool operator<=(const SameProcedural& relative) const
+    {
+        return !(relative < *this);
+    }
+
+    /** 
+     * @brief         
+     *     Greater than or equal to operator implementation.
+     * @param[in] relative
+     *     Procedural object to be compared greater than or equal to.
+     * @return
+     *     True only if this is not less than relative.
+     */
+    bool operator>=(const SameProcedural& relative) const
+    {
+        return !(*this < relative);
+    }
+
+    /**
+     * @brief
+     *     Identity ordering.
+     * @param[in] relative
+     *     Procedural object whose identity is compared.
+     * @return
+     *     True only if the identity of this collates before the identity 
+     *     of relative.
+     */
+    bool precedes(const SameProcedural& relative) const
+    {
+        const void* const identity = identify();
+        const void* const other = relative.identify();
+        return Collate(&identity, &other, sizeof(identity)) < 0;
+    }
+
+    /**
+     * @brief
+     *     Pure virtual identity function.
+     * @details
+     *     This function must be implemented by classes which are derived 
+     *     from this class, by returning the address of the identity tag of
+     *     the most derived class.
+     * @return
+     *     Address of the identity tag of the most derived class.
+     */
+    virtual const void* identify() const = 0;
+
+protected:
+    /**
+     * @brief
+     *     Construct the comparable base of a derived class.
+     */
+    constexpr ComparablyProcedural() = default;
 };
+#endif
 
 /**
  * @brief         
@@ -161,6 +632,36 @@ public:
         return !operator==(relative);
     }
 
+    /**
+     * @brief
+     *     Hash function implementation specific to this class.
+     * @param[in] digest
+     *     Digest to be continued.
+     * @return
+     *     Digest continued with the address of the callable object.
+     */
+    Cardinal hash(Cardinal digest = DigestBasis) const
+    {
+        const auto address = &object;
+        return Digest(&address, sizeof(address), digest);
+    }
+
+    /** 
+     * @brief         
+     *     Less than operator implementation specific to this class.
+     * @param[in] relative
+     *     Same objective type instance to be compared less than.
+     * @return
+     *     True only if the address of the callable object collates before
+     *     that of relative.
+     */
+    bool operator<(const SameObjective& relative) const
+    {
+        const auto address = &object;
+        const auto other = &relative.object;
+        return Collate(&address, &other, sizeof(address)) < 0;
+    }
+
 protected:
     /** 
      * @brief         
@@ -223,7 +724,8 @@ public:
      *     The procedural call object which will be called by reference.
      */
     constexpr SimplyObjective(Typical& object)
-        : BaseObjective(object)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseObjective(object)
     {
     }
 
@@ -236,7 +738,8 @@ public:
      *     The instance of this class to copy.
      */
     constexpr SimplyObjective(const BaseObjective& copy)
-        : BaseObjective(copy)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseObjective(copy)
     {
     }
 
@@ -247,16 +750,17 @@ public:
      *     Implements the procedural call operator by calling the object
      *     by reference and returning it's result to the calling context.
      * @param[in] ...arguments
-     *     Argument pack which is expanded.
+     *     Argument pack which is expanded and forwarded.
      * @return
      *     The return result of the call.
      */
-    Resultant operator()(Parametric... arguments) const final
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
     {
-        return this->object(arguments...);
+        return this->object(static_cast<Parametric&&>(arguments)...);
     }
 };
 
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
 /**
  * @brief         
  *     Class for calling or comparing any callable object.
@@ -278,7 +782,13 @@ public:
      * @brief
      *     Base class template instance alias.
      */
-    using BaseProcedural = Procedural<Resultant, Parametric...>;
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameObjective = ComparablyObjective<Typical, Resultant, Parametric...>;
 
     /**
      * @brief
@@ -319,46 +829,82 @@ public:
      *     Implements the procedural call operator by calling the object
      *     by reference and returning it's result to the calling context.
      * @param[in] ...arguments
-     *     Argument pack which is expanded.
+     *     Argument pack which is expanded and forwarded.
      * @return
      *     The return result of the call.
      */
     Resultant operator()(Parametric... arguments) const final
     {
-        return this->object(arguments...);
+        return this->object(static_cast<Parametric&&>(arguments)...);
     }
 
     /** 
      * @brief         
      *     ComparablyProcedural equal to operator.
      * @details       
-     *     Implements the procedural equal to operator.  If the macro 
-     *     PROCEDURE_MODULE_NORTTI is not defined, this operator uses a 
-     *     dynamic cast and if relative is not of the same base objective
-     *     class it returns false.  If relative is of the same base 
-     *     objective class it compares their object member addresses and 
-     *     returns the result.  If the macro PROCEDURE_MODULE_NORTTI is 
-     *     defined, compares the address of this to the address of relative
-     *     and only returns true if they are  equal.  Do not create more 
-     *     than one objective instance per unique callable object address 
-     *     if the equal to operator will be in use without RTTI available.
+     *     Implements the procedural equal to operator.  If relative does 
+     *     not have the identity of this class it returns false, otherwise 
+     *     it compares their object member addresses and returns the result.
+     *     Run-time type information (RTTI) is not required.
      * @param[in] relative
      *     Relative procedural instance to compare equality with.
      * @return
-     *     True only under conditions described in details section.
+     *     True only if relative is of this class and references the same
+     *     object.
      */
-    bool operator==(const BaseProcedural& relative) const final
+    bool operator==(const SameProcedural& relative) const final
     {
-#ifndef PROCEDURE_MODULE_NORTTI
-        const BaseObjective* same = dynamic_cast<const BaseObjective*>(&relative);
-        if (!same)
+        if (relative.identify() != this->identify())
             return false;
-        return BaseObjective::operator==(*same);
-#else
-        return &relative == this;
-#endif
+        return BaseObjective::operator==(static_cast<const SameObjective&>(relative));
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameObjective>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @details
+     *     Implements the procedural hash function using the identity of 
+     *     this class and the address of the callable object.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseObjective::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @details       
+     *     Implements the procedural less than operator.  If relative does 
+     *     not have the identity of this class, the identities are ordered,
+     *     otherwise the Objective less than operator is used.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        return BaseObjective::operator<(static_cast<const SameObjective&>(relative));
     }
 };
+#endif
 
 /**
  * @brief         
@@ -425,7 +971,43 @@ public:
         return !operator==(relative);
     }
 
-protected:
+    /**
+     * @brief
+     *     Hash function implementation specific to this class.
+     * @param[in] digest
+     *     Digest to be continued.
+     * @return
+     *     Digest continued with the address of the object and the 
+     *     representation of the member function pointer.
+     */
+    Cardinal hash(Cardinal digest = DigestBasis) const
+    {
+        const void* const address = &object;
+        digest = Digest(&address, sizeof(address), digest);
+        return Digest(&method, sizeof(method), digest);
+    }
+
+    /** 
+     * @brief         
+     *     Less than operator implementation specific to this class.
+     * @param[in] relative
+     *     Same methodic type instance to be compared less than.
+     * @return
+     *     True only if the address of the object collates before that of 
+     *     relative, or if the addresses are equal and the member function
+     *     pointer collates before that of relative.
+     */
+    bool operator<(const SameMethodic& relative) const
+    {
+        const void* const address = &object;
+        const void* const other = &relative.object;
+        const int order = Collate(&address, &other, sizeof(address));
+        if (order)
+            return order < 0;
+        return Collate(&method, &relative.method, sizeof(method)) < 0;
+    }
+
+protected:
     /** 
      * @brief         
      *     Construct a callable object member function reference.
@@ -505,7 +1087,8 @@ public:
      *     The member function pointer location.
      */
     constexpr SimplyMethodic(Typical& object, const MethodLocational method)
-        : BaseMethodic(object, method)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseMethodic(object, method)
     {
     }
 
@@ -518,7 +1101,8 @@ public:
      *     The instance of this class to copy.
      */
     constexpr SimplyMethodic(const BaseMethodic& copy)
-        : BaseMethodic(copy)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseMethodic(copy)
     {
     }
 
@@ -529,16 +1113,17 @@ public:
      *     Implements the procedural call operator by calling the object
      *     member function and returning it's result to the calling context.
      * @param[in] ...arguments
-     *     Argument pack which is expanded.
+     *     Argument pack which is expanded and forwarded.
      * @return
      *     The return result of the call.
      */
-    Resultant operator()(Parametric... arguments) const final
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
     {
-        return (this->object.*this->method)(arguments...);
+        return (this->object.*this->method)(static_cast<Parametric&&>(arguments)...);
     }
 };
 
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
 /**
  * @brief         
  *     Class for calling or comparing any callable object member function.
@@ -563,7 +1148,13 @@ public:
      * @brief
      *     Base class template instance alias.
      */
-    using BaseProcedural = Procedural<Resultant, Parametric...>;
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameMethodic = ComparablyMethodic<Typical, MethodLocational, Resultant, Parametric...>;
 
     /**
      * @brief
@@ -607,128 +1198,505 @@ public:
      *     Implements the procedural call operator by calling the object
      *     member function and returning it's result to the calling context.
      * @param[in] ...arguments
-     *     Argument pack which is expanded.
+     *     Argument pack which is expanded and forwarded.
      * @return
      *     The return result of the call.
      */
     Resultant operator()(Parametric... arguments) const final
     {
-        return (this->object.*this->method)(arguments...);
+        return (this->object.*this->method)(static_cast<Parametric&&>(arguments)...);
     }
 
     /** 
      * @brief         
      *     ComparablyProcedural equal to operator.
      * @details       
-     *     Implements the procedural equal to operator.  If the macro 
-     *     PROCEDURE_MODULE_NORTTI is not defined, this operator uses a 
-     *     dynamic cast and if relative is not of the same base methodic
-     *     class it returns false.  If relative is of the same base 
-     *     methodic class it compares their object and method addresses and 
-     *     returns the result.  If the macro PROCEDURE_MODULE_NORTTI is 
-     *     defined, compares this to the address of relative and only 
-     *     returns true if they are  equal.  Do not create more than one 
-     *     methodic instance per unique callable object address if the equal
-     *     to operator will be in use without RTTI available.
+     *     Implements the procedural equal to operator.  If relative does 
+     *     not have the identity of this class it returns false, otherwise 
+     *     it compares their object and method addresses and returns the 
+     *     result.  Run-time type information (RTTI) is not required.
      * @param[in] relative
      *     Relative procedural instance to compare equality with.
      * @return
-     *     True only under conditions described in details section.
+     *     True only if relative is of this class and references the same
+     *     object and member function.
      */
-    bool operator==(const BaseProcedural& relative) const final
+    bool operator==(const SameProcedural& relative) const final
     {
-#ifndef PROCEDURE_MODULE_NORTTI
-        const BaseMethodic* same = dynamic_cast<const BaseMethodic*>(&relative);
-        if (!same)
+        if (relative.identify() != this->identify())
             return false;
-        return BaseMethodic::operator==(*same);
-#else
-        return &relative == this;
-#endif
+        return BaseMethodic::operator==(static_cast<const SameMethodic&>(relative));
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameMethodic>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @details
+     *     Implements the procedural hash function using the identity of 
+     *     this class, the address of the object and the member function
+     *     pointer.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseMethodic::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @details       
+     *     Implements the procedural less than operator.  If relative does 
+     *     not have the identity of this class, the identities are ordered,
+     *     otherwise the Methodic less than operator is used.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        return BaseMethodic::operator<(static_cast<const SameMethodic&>(relative));
     }
 };
+#endif
 
 /**
- * @brief         
- *     Explicitly specifies a call return and parameter type expectation.
- * @details       
- *     This null pointer constant expression object is used to specify the
- *     return and parameter types of the call to a Procure template instance.
+ * @brief
+ *     Class for calling a compile time specified object member function.
+ * @details
+ *     This type is used to call an object member function which is given as
+ *     a template argument, rather than stored as with SimplyMethodic.  Only
+ *     the object reference is stored, a null member function pointer fails 
+ *     to compile and the member function can be inlined into the final call
+ *     operator.  Define the macro PROCEDURE_MODULE_NOSTDCPP to prevent 
+ *     static assertions using the type_traits standard library header.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam method
+ *     Pointer to the member function which will be called.
  * @tparam Resultant
  *     Return type of the call.
  * @tparam ...Parametric
  *     Parameter pack which represents the parameter types of the call.
  */
-template <class Resultant, class... Parametric>
-constexpr Functional<Resultant, Parametric...>* Guide = 0;
+template <class Typical, class MethodLocational, MethodLocational method, class Resultant, class... Parametric>
+class StaticallyMethodic : public Procedural<Resultant, Parametric...> {
+
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    static_assert(
+        ::std::is_member_function_pointer<MethodLocational>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+    static_assert(method != MethodLocational(), "method: Null member function pointer");
+
+public:
+    /**
+     * @brief
+     *     Same class template instance alias.
+     */
+    using SameMethodic = StaticallyMethodic<Typical, MethodLocational, method, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct an object member function reference.
+     * @details       
+     *     The resulting instance will only reference the specified object.
+     * @param[in] object
+     *     The object which the member function will reference.
+     */
+    constexpr StaticallyMethodic(Typical& object)
+        : Procedural<Resultant, Parametric...>(this)
+        , object(object)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Construct a copy of an object member function reference.
+     * @details       
+     *     The resulting instance will reference the same object.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    constexpr StaticallyMethodic(const SameMethodic& copy)
+        : Procedural<Resultant, Parametric...>(this)
+        , object(copy.object)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Equal to operator implementation specific to this class.
+     * @details       
+     *     This operator compares the addresses of the objects, the member 
+     *     function is the same for all instances of this class.
+     * @param[in] relative
+     *     Same methodic type instance to be compared equal to.
+     * @return
+     *     True only if both reference the same object.
+     */
+    constexpr bool operator==(const SameMethodic& relative) const
+    {
+        return &object == &relative.object;
+    }
+
+    /** 
+     * @brief         
+     *     Not equal to operator implementation specific to this class.
+     * @param[in] relative
+     *     Same methodic type instance to be compared not equal to.
+     * @return
+     *     False only if both reference the same object.
+     */
+    constexpr bool operator!=(const SameMethodic& relative) const
+    {
+        return !operator==(relative);
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object member function call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     member function and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return (object.*method)(static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    Typical& object; /**< Object reference. */
+};
 
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
 /**
  * @brief         
- *     Specify a function as a procedural call object.
+ *     Abstract repeatable procedural base class.
  * @details       
- *     This function template is used to create a simple representation of a 
- *     procedural call to a function.
+ *     This type is used to call any procedure matching the specified return
+ *     and parameter types, either once or repeatedly over arrays of 
+ *     arguments with one virtual call.  The repeated call operator is 
+ *     implemented with a loop inside the final override, so the procedure 
+ *     can be inlined into the loop.  Return values of repeated calls are 
+ *     discarded.
  * @tparam Resultant
  *     Return type of the call.
  * @tparam ...Parametric
  *     Parameter pack which represents the parameter types of the call.
- * @param[in] function
- *     Reference to the function which will be called.
- * @return
- *     Procedural object which references function.
  */
 template <class Resultant, class... Parametric>
-static constexpr SimplyObjective<Resultant(Parametric...), Resultant, Parametric...>
-Procure(
-    Functional<Resultant, Parametric...>&
-        function)
-{
-    using Specific = SimplyObjective<Resultant(Parametric...), Resultant, Parametric...>;
-    return Specific(function);
-}
+class RepeatedlyProcedural : public Procedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using BaseProcedural = Procedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Single call operator, which would otherwise be hidden.
+     */
+    using BaseProcedural::operator();
+
+    /**
+     * @brief
+     *     Pure virtual repeated call operator.
+     * @details
+     *     This operator must be implemented by classes which are derived 
+     *     from this class.  Implementations must call the procedure count
+     *     times, where each call passes the argument at the same index of 
+     *     each array.  Arguments are passed as lvalues, unless the parameter
+     *     is an rvalue reference in which case they are moved.
+     * @param[in] count
+     *     Number of calls, which is the length of each argument array.
+     * @param[in] ...arguments
+     *     One array of arguments for each parameter.
+     */
+    virtual void operator()(Cardinal count, typename Unreferenced<Parametric>::Type*... arguments) const = 0;
+};
 
 /**
  * @brief         
- *     Specify a callable object as a procedural call object.
+ *     Class for calling any callable object once or repeatedly.
  * @details       
- *     This function template is used to create a simple representation of a 
- *     procedural call to any callable object.  This overload is used for 
- *     lambda objects and user defined class call operator objects.  It can
- *     also be used with function types to specify rather than deduce the 
- *     return and parameter types.
+ *     This type is used to call any callable object over arrays of 
+ *     arguments.
  * @tparam Typical
- *     Type of the object.
+ *     Type of the callable object.
  * @tparam Resultant
  *     Return type of the call.
  * @tparam ...Parametric
  *     Parameter pack which represents the parameter types of the call.
- * @param[in] object
- *     Reference to the object which will be called.
- * @param[in] guide
- *     Used for template argument deduction, value is ignored.
  */
 template <class Typical, class Resultant, class... Parametric>
-static constexpr SimplyObjective<Typical, Resultant, Parametric...>
-Procure(
-    Typical&
-        object,
-    Functional<Resultant, Parametric...>*
-        guide)
-{
-    using Specific = SimplyObjective<Typical, Resultant, Parametric...>;
-    return Specific(object);
-}
+class RepeatedlyObjective : public RepeatedlyProcedural<Resultant, Parametric...>,
+                            public Objective<Typical, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseObjective = Objective<Typical, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object reference.
+     * @details       
+     *     The resulting instance will only reference the specified object.
+     * @param[in] object
+     *     The procedural call object which will be called by reference.
+     */
+    constexpr RepeatedlyObjective(Typical& object)
+        : BaseObjective(object)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Construct a copy of a callable object reference.
+     * @details       
+     *     The resulting instance will reference the same object.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    constexpr RepeatedlyObjective(const BaseObjective& copy)
+        : BaseObjective(copy)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     by reference and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return this->object(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object repeated call operator.
+     * @details       
+     *     Implements the repeated call operator by calling the object by
+     *     reference once for each index of the argument arrays.
+     * @param[in] count
+     *     Number of calls, which is the length of each argument array.
+     * @param[in] ...arguments
+     *     One array of arguments for each parameter.
+     */
+    void operator()(Cardinal count, typename Unreferenced<Parametric>::Type*... arguments) const final
+    {
+        for (Cardinal index = 0; index < count; index++)
+            this->object(static_cast<Parametric>(arguments[index])...);
+    }
+};
 
 /**
  * @brief         
- *     Specify an object member function as a procedural call object.
+ *     Class for calling any object member function once or repeatedly.
  * @details       
- *     This function template is used to create a simple representation of a 
- *     procedural call to an object member function.  Define the macro
- *     PROCEDURE_MODULE_NOSTDCPP to prevent static assertions if the 
- *     type_traits standard library header is not available.
+ *     This type is used to call any object member function over arrays of 
+ *     arguments.
  * @tparam Typical
- *     Type of the data object.
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class MethodLocational, class Resultant, class... Parametric>
+class RepeatedlyMethodic : public RepeatedlyProcedural<Resultant, Parametric...>,
+                           public Methodic<Typical, MethodLocational, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseMethodic = Methodic<Typical, MethodLocational, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object member function reference.
+     * @details       
+     *     The resulting instance will only reference the specified object
+     *     and member function pointer location.
+     * @param[in] object
+     *     The object which the member function will reference.
+     * @param[in] method
+     *     The member function pointer location.
+     */
+    constexpr RepeatedlyMethodic(Typical& object, const MethodLocational method)
+        : BaseMethodic(object, method)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Construct a copy of a callable object reference.
+     * @details       
+     *     The resulting instance will reference the same object.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    constexpr RepeatedlyMethodic(const BaseMethodic& copy)
+        : BaseMethodic(copy)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object member function call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     member function and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return (this->object.*this->method)(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object member function repeated call operator.
+     * @details       
+     *     Implements the repeated call operator by calling the object member
+     *     function once for each index of the argument arrays.
+     * @param[in] count
+     *     Number of calls, which is the length of each argument array.
+     * @param[in] ...arguments
+     *     One array of arguments for each parameter.
+     */
+    void operator()(Cardinal count, typename Unreferenced<Parametric>::Type*... arguments) const final
+    {
+        Typical& object = this->object;
+        const MethodLocational method = this->method;
+        for (Cardinal index = 0; index < count; index++)
+            (object.*method)(static_cast<Parametric>(arguments[index])...);
+    }
+};
+#endif
+
+/**
+ * @brief         
+ *     Explicitly specifies a call return and parameter type expectation.
+ * @details       
+ *     This null pointer constant expression object is used to specify the
+ *     return and parameter types of the call to a Procure template instance.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+constexpr Functional<Resultant, Parametric...>* Guide = 0;
+
+/**
+ * @brief         
+ *     Specify a function as a procedural call object.
+ * @details       
+ *     This function template is used to create a simple representation of a 
+ *     procedural call to a function.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] function
+ *     Reference to the function which will be called.
+ * @return
+ *     Procedural object which references function.
+ */
+template <class Resultant, class... Parametric>
+static constexpr SimplyObjective<Resultant(Parametric...), Resultant, Parametric...>
+Procure(
+    Functional<Resultant, Parametric...>&
+        function)
+{
+    using Specific = SimplyObjective<Resultant(Parametric...), Resultant, Parametric...>;
+    return Specific(function);
+}
+
+/**
+ * @brief         
+ *     Specify a callable object as a procedural call object.
+ * @details       
+ *     This function template is used to create a simple representation of a 
+ *     procedural call to any callable object.  This overload is used for 
+ *     lambda objects and user defined class call operator objects.  It can
+ *     also be used with function types to specify rather than deduce the 
+ *     return and parameter types.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ */
+template <class Typical, class Resultant, class... Parametric>
+static constexpr SimplyObjective<Typical, Resultant, Parametric...>
+Procure(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = SimplyObjective<Typical, Resultant, Parametric...>;
+    return Specific(object);
+}
+
+/**
+ * @brief         
+ *     Specify an object member function as a procedural call object.
+ * @details       
+ *     This function template is used to create a simple representation of a 
+ *     procedural call to an object member function.  Define the macro
+ *     PROCEDURE_MODULE_NOSTDCPP to prevent static assertions if the 
+ *     type_traits standard library header is not available.
+ * @tparam Typical
+ *     Type of the data object.
  * @tparam MethodLocational
  *     Pointer to member function type.
  * @tparam Resultant
@@ -762,6 +1730,79 @@ Procure(
     return Specific(object, method);
 }
 
+/**
+ * @brief         
+ *     Specify a compile time object member function as a procedural call 
+ *     object.
+ * @details       
+ *     This function template is used to create a simple representation of a 
+ *     procedural call to an object member function which is specified as a
+ *     template argument, for example 
+ *     Procure<decltype(&Class::member), &Class::member>(object, guide).  
+ *     When the compiler supports auto template parameters, 
+ *     Procure<&Class::member>(object, guide) may be used instead.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam method
+ *     Pointer to the member function which will be called.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ */
+template <class MethodLocational, MethodLocational method, class Typical, class Resultant, class... Parametric>
+static constexpr StaticallyMethodic<Typical, MethodLocational, method, Resultant, Parametric...>
+Procure(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = StaticallyMethodic<Typical, MethodLocational, method, Resultant, Parametric...>;
+    return Specific(object);
+}
+
+#ifdef __cpp_nontype_template_parameter_auto
+/**
+ * @brief         
+ *     Specify a compile time object member function as a procedural call 
+ *     object.
+ * @details       
+ *     This function template is the same as the above, except that the 
+ *     pointer to member function type is deduced from method.
+ * @tparam method
+ *     Pointer to the member function which will be called.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ */
+template <auto method, class Typical, class Resultant, class... Parametric>
+static constexpr StaticallyMethodic<Typical, decltype(method), method, Resultant, Parametric...>
+Procure(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = StaticallyMethodic<Typical, decltype(method), method, Resultant, Parametric...>;
+    return Specific(object);
+}
+#endif
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
 /**
  * @brief         
  *     Specify a function as a procedural call object.
@@ -860,6 +1901,4756 @@ ProcureComparably(
     return Specific(object, method);
 }
 
+/**
+ * @brief         
+ *     Specify a function as a repeatable procedural call object.
+ * @details       
+ *     This function template is used to create a repeatable representation
+ *     of a procedural call to a function.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] function
+ *     Reference to the function which will be called.
+ */
+template <class Resultant, class... Parametric>
+static constexpr RepeatedlyObjective<Resultant(Parametric...), Resultant, Parametric...>
+ProcureRepeatedly(
+    Functional<Resultant, Parametric...>&
+        function)
+{
+    using Specific = RepeatedlyObjective<Resultant(Parametric...), Resultant, Parametric...>;
+    return Specific(function);
+}
+
+/**
+ * @brief         
+ *     Specify a callable object as a repeatable procedural call object.
+ * @details       
+ *     This function template is used to create a repeatable representation
+ *     of a procedural call to any callable object.  This overload is used 
+ *     for lambda objects and user defined class call operator objects.  It
+ *     can also be used with function types to specify rather than deduce 
+ *     the return and parameter types.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ */
+template <class Typical, class Resultant, class... Parametric>
+static constexpr RepeatedlyObjective<Typical, Resultant, Parametric...>
+ProcureRepeatedly(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = RepeatedlyObjective<Typical, Resultant, Parametric...>;
+    return Specific(object);
 }
 
+/**
+ * @brief         
+ *     Specify an object member function as a repeatable procedural call 
+ *     object.
+ * @details       
+ *     This function template is used to create a repeatable representation
+ *     of a procedural call to an object member function.  Define the macro
+ *     PROCEDURE_MODULE_NOSTDCPP to prevent static assertions if the 
+ *     type_traits standard library header is not available.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] method
+ *     Pointer to the member function which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ */
+template <class Typical, class MethodLocational, class Resultant, class... Parametric>
+static constexpr RepeatedlyMethodic<Typical, MethodLocational, Resultant, Parametric...>
+ProcureRepeatedly(
+    Typical&
+        object,
+    const MethodLocational
+        method,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    using namespace std;
+    static_assert(
+        is_member_function_pointer<MethodLocational>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+    using Specific = RepeatedlyMethodic<Typical, MethodLocational, Resultant, Parametric...>;
+    return Specific(object, method);
+}
+#endif
+
+/**
+ * @brief
+ *     Index sequence type.
+ * @details
+ *     This type is used in place of the standard library integer sequence
+ *     so that no header is required.
+ * @tparam ...indices
+ *     Sequence of indices.
+ */
+template <Cardinal... indices>
+struct Sequential {
+};
+
+/**
+ * @brief
+ *     Index sequence generator.
+ * @details
+ *     This class template provides the index sequence from zero to one less
+ *     than count as the Type member.
+ * @tparam count
+ *     Number of indices.
+ * @tparam ...indices
+ *     Indices generated so far.
+ */
+template <Cardinal count, Cardinal... indices>
+struct Sequencing : Sequencing<count - 1, count - 1, indices...> {
+};
+
+/**
+ * @brief
+ *     Index sequence generator specialization which ends generation.
+ */
+template <Cardinal... indices>
+struct Sequencing<0, indices...> {
+    using Type = Sequential<indices...>; /**< Generated index sequence. */
+};
+
+/**
+ * @brief
+ *     Single bound argument storage.
+ * @tparam index
+ *     Position of the bound argument.
+ * @tparam Typical
+ *     Type of the bound argument.
+ */
+template <Cardinal index, class Typical>
+struct Bindable {
+    Typical value; /**< Bound argument value. */
+};
+
+/**
+ * @brief
+ *     Bound argument storage declaration.
+ * @tparam Sequencial
+ *     Index sequence of the bound arguments.
+ * @tparam ...Bounds
+ *     Types of the bound arguments.
+ */
+template <class Sequencial, class... Bounds>
+class Binding;
+
+/**
+ * @brief
+ *     Bound argument storage.
+ * @details
+ *     This type stores bound argument values inline and calls a callable
+ *     object or member function with them followed by the remaining 
+ *     arguments.  Bound arguments are passed as constant lvalues.  Values
+ *     are compared by their equal to operator, which is only required if
+ *     the comparison is used, and ordered by their less than operator, or
+ *     left equivalent if they do not have one.
+ * @tparam ...indices
+ *     Index sequence of the bound arguments.
+ * @tparam ...Bounds
+ *     Types of the bound arguments.
+ */
+template <Cardinal... indices, class... Bounds>
+class Binding<Sequential<indices...>, Bounds...> : Bindable<indices, Bounds>... {
+
+public:
+    /**
+     * @brief
+     *     Index sequence type alias.
+     */
+    using Sequencial = Sequential<indices...>;
+
+    /**
+     * @brief
+     *     Construct bound argument values.
+     * @tparam ...Propagational
+     *     Types of the bound arguments, deduced as forwarding references.
+     * @param[in] sequence
+     *     Used to distinguish this from the copy constructor, value is 
+     *     ignored.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr Binding(Sequencial sequence, Propagational&&... bounds)
+        : Bindable<indices, Bounds>{ static_cast<Propagational&&>(bounds) }...
+    {
+    }
+
+    /**
+     * @brief
+     *     Call a callable object with the bound and remaining arguments.
+     * @param[in] object
+     *     Reference to the callable object.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    template <class Resultant, class Typical, class... Parametric>
+    Resultant call(Typical& object, Parametric&&... arguments) const
+    {
+        return object(Bindable<indices, Bounds>::value..., static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Call a callable object with the bound arguments moved, and the 
+     *     remaining arguments.
+     * @details
+     *     Used when the bound arguments are called only once, so that they
+     *     are moved into parameters declared by value or as rvalue 
+     *     references.
+     * @param[in] object
+     *     Reference to the callable object.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    template <class Resultant, class Typical, class... Parametric>
+    Resultant consume(Typical& object, Parametric&&... arguments)
+    {
+        return object(static_cast<Bounds&&>(Bindable<indices, Bounds>::value)..., static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Call an object member function with the bound and remaining 
+     *     arguments.
+     * @param[in] object
+     *     Reference to the object.
+     * @param[in] method
+     *     Pointer to the member function.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    template <class Resultant, class Typical, class MethodLocational, class... Parametric>
+    Resultant invoke(Typical& object, MethodLocational method, Parametric&&... arguments) const
+    {
+        return (object.*method)(Bindable<indices, Bounds>::value..., static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Equal to operator.
+     * @param[in] relative
+     *     Bound arguments to be compared equal to.
+     * @return
+     *     True only if every bound argument is equal.
+     */
+    bool operator==(const Binding& relative) const
+    {
+        const bool equal[] = { true, (Bindable<indices, Bounds>::value == relative.Bindable<indices, Bounds>::value)... };
+        for (const bool each : equal)
+            if (!each)
+                return false;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Lexicographic less than operator.
+     * @param[in] relative
+     *     Bound arguments to be compared less than.
+     * @return
+     *     True only if the first bound argument which is not equivalent is
+     *     less than that of relative.
+     */
+    bool operator<(const Binding& relative) const
+    {
+        const int order[] = { 0, Order(Bindable<indices, Bounds>::value, relative.Bindable<indices, Bounds>::value, 0)... };
+        for (const int each : order)
+            if (each)
+                return each < 0;
+        return false;
+    }
+
+private:
+    template <class Typical>
+    static auto Order(const Typical& value, const Typical& other, int) -> decltype(static_cast<bool>(value < other), 0)
+    {
+        return value < other ? -1 : other < value ? 1 : 0;
+    }
+
+    template <class Typical>
+    static int Order(const Typical&, const Typical&, long)
+    {
+        return 0;
+    }
+};
+
+/**
+ * @brief
+ *     Bound argument storage for a list of types.
+ * @details
+ *     This type is the Binding for the index sequence of the bound argument
+ *     types, so that it can be named by the types alone.
+ * @tparam ...Bounds
+ *     Types of the bound arguments.
+ */
+template <class... Bounds>
+class Bound : public Binding<typename Sequencing<sizeof...(Bounds)>::Type, Bounds...> {
+
+public:
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using BaseBinding = Binding<typename Sequencing<sizeof...(Bounds)>::Type, Bounds...>;
+
+    /**
+     * @brief
+     *     Construct bound argument values.
+     * @param[in] sequence
+     *     Used to distinguish this from the copy constructor, value is 
+     *     ignored.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr Bound(typename BaseBinding::Sequencial sequence, Propagational&&... bounds)
+        : BaseBinding(sequence, static_cast<Propagational&&>(bounds)...)
+    {
+    }
+};
+
+/**
+ * @brief
+ *     Class for calling any callable object with leading bound arguments.
+ * @details
+ *     This type is used to call any callable object with bound argument 
+ *     values stored inline, followed by the remaining arguments of the 
+ *     call, so that no heap allocation is required.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Binding
+ *     Bound instance which stores the bound arguments.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ */
+template <class Typical, class Binding, class Resultant, class... Parametric>
+class PartiallyObjective : public Procedural<Resultant, Parametric...>,
+                           public Objective<Typical, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseObjective = Objective<Typical, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object reference with bound arguments.
+     * @param[in] object
+     *     The procedural call object which will be called by reference.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr PartiallyObjective(Typical& object, Propagational&&... bounds)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseObjective(object)
+        , bound(typename Binding::Sequencial(), static_cast<Propagational&&>(bounds)...)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     by reference with the bound arguments followed by the remaining
+     *     arguments and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return bound.template call<Resultant>(this->object, static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    Binding bound; /**< Bound arguments. */
+};
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief         
+ *     Class for calling or comparing any callable object with leading 
+ *     bound arguments.
+ * @details       
+ *     This type is the comparable form of PartiallyObjective.  Equal 
+ *     procedures reference the same object and have equal bound arguments,
+ *     so the bound argument types must have equal to operators.  Bound 
+ *     arguments without a less than operator are not ordered, so such 
+ *     procedures which differ only in them are equivalent but not equal.
+ *     The hash function does not include the bound arguments.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Binding
+ *     Bound instance which stores the bound arguments.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ */
+template <class Typical, class Binding, class Resultant, class... Parametric>
+class ComparablyPartiallyObjective : public ComparablyProcedural<Resultant, Parametric...>,
+                                     public Objective<Typical, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameObjective = ComparablyPartiallyObjective<Typical, Binding, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseObjective = Objective<Typical, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object reference with bound arguments.
+     * @param[in] object
+     *     The procedural call object which will be called by reference.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr ComparablyPartiallyObjective(Typical& object, Propagational&&... bounds)
+        : BaseObjective(object)
+        , bound(typename Binding::Sequencial(), static_cast<Propagational&&>(bounds)...)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     by reference with the bound arguments followed by the remaining
+     *     arguments and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return bound.template call<Resultant>(this->object, static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural equal to operator.
+     * @param[in] relative
+     *     Relative procedural instance to compare equality with.
+     * @return
+     *     True only if relative is of this class, references the same
+     *     object and has equal bound arguments.
+     */
+    bool operator==(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return false;
+        const SameObjective& same = static_cast<const SameObjective&>(relative);
+        return BaseObjective::operator==(same) && bound == same.bound;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameObjective>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @details
+     *     Implements the procedural hash function using the identity of 
+     *     this class and the address of the callable object.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseObjective::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @details       
+     *     If relative does not have the identity of this class, the 
+     *     identities are ordered, otherwise the object addresses and then
+     *     the bound arguments are ordered.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        const SameObjective& same = static_cast<const SameObjective&>(relative);
+        if (BaseObjective::operator<(same))
+            return true;
+        if (same.BaseObjective::operator<(*this))
+            return false;
+        return bound < same.bound;
+    }
+
+private:
+    Binding bound; /**< Bound arguments. */
+};
+#endif
+
+/**
+ * @brief
+ *     Class for calling any callable object member function with leading
+ *     bound arguments.
+ * @details
+ *     This type is used to call any object member function with bound 
+ *     argument values stored inline, followed by the remaining arguments 
+ *     of the call, so that no heap allocation is required.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Binding
+ *     Bound instance which stores the bound arguments.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ */
+template <class Typical, class MethodLocational, class Binding, class Resultant, class... Parametric>
+class PartiallyMethodic : public Procedural<Resultant, Parametric...>,
+                          public Methodic<Typical, MethodLocational, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseMethodic = Methodic<Typical, MethodLocational, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object member function reference with bound
+     *     arguments.
+     * @param[in] object
+     *     The object which the member function will reference.
+     * @param[in] method
+     *     The member function pointer location.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr PartiallyMethodic(Typical& object, const MethodLocational method, Propagational&&... bounds)
+        : Procedural<Resultant, Parametric...>(this)
+        , BaseMethodic(object, method)
+        , bound(typename Binding::Sequencial(), static_cast<Propagational&&>(bounds)...)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object member function call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     member function with the bound arguments followed by the 
+     *     remaining arguments and returning it's result to the calling 
+     *     context.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return bound.template invoke<Resultant>(this->object, this->method, static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    Binding bound; /**< Bound arguments. */
+};
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief
+ *     Class for calling or comparing any callable object member function
+ *     with leading bound arguments.
+ * @details       
+ *     This type is the comparable form of PartiallyMethodic.  Equal 
+ *     procedures reference the same object and member function and have
+ *     equal bound arguments, so the bound argument types must have equal 
+ *     to operators.  Bound arguments without a less than operator are not
+ *     ordered, so such procedures which differ only in them are equivalent
+ *     but not equal.  The hash function does not include the bound 
+ *     arguments.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Binding
+ *     Bound instance which stores the bound arguments.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ */
+template <class Typical, class MethodLocational, class Binding, class Resultant, class... Parametric>
+class ComparablyPartiallyMethodic : public ComparablyProcedural<Resultant, Parametric...>,
+                                    public Methodic<Typical, MethodLocational, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameMethodic = ComparablyPartiallyMethodic<Typical, MethodLocational, Binding, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseMethodic = Methodic<Typical, MethodLocational, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a callable object member function reference with bound
+     *     arguments.
+     * @param[in] object
+     *     The object which the member function will reference.
+     * @param[in] method
+     *     The member function pointer location.
+     * @param[in] ...bounds
+     *     Bound arguments which are copied if they are lvalues, otherwise
+     *     they are moved.
+     */
+    template <class... Propagational>
+    constexpr ComparablyPartiallyMethodic(Typical& object, const MethodLocational method, Propagational&&... bounds)
+        : BaseMethodic(object, method)
+        , bound(typename Binding::Sequencial(), static_cast<Propagational&&>(bounds)...)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object member function call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object
+     *     member function with the bound arguments followed by the 
+     *     remaining arguments and returning it's result to the calling 
+     *     context.
+     * @param[in] ...arguments
+     *     Remaining argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return bound.template invoke<Resultant>(this->object, this->method, static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural equal to operator.
+     * @param[in] relative
+     *     Relative procedural instance to compare equality with.
+     * @return
+     *     True only if relative is of this class, references the same 
+     *     object and member function and has equal bound arguments.
+     */
+    bool operator==(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return false;
+        const SameMethodic& same = static_cast<const SameMethodic&>(relative);
+        return BaseMethodic::operator==(same) && bound == same.bound;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameMethodic>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @details
+     *     Implements the procedural hash function using the identity of 
+     *     this class, the address of the object and the member function 
+     *     pointer.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseMethodic::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @details       
+     *     If relative does not have the identity of this class, the 
+     *     identities are ordered, otherwise the object addresses and member
+     *     function pointers and then the bound arguments are ordered.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        const SameMethodic& same = static_cast<const SameMethodic&>(relative);
+        if (BaseMethodic::operator<(same))
+            return true;
+        if (same.BaseMethodic::operator<(*this))
+            return false;
+        return bound < same.bound;
+    }
+
+private:
+    Binding bound; /**< Bound arguments. */
+};
+#endif
+
+/**
+ * @brief         
+ *     Specify a callable object with leading bound arguments as a 
+ *     procedural call object.
+ * @details       
+ *     This function template is used to create a representation of a 
+ *     procedural call to any callable object, which is called with bound 
+ *     arguments stored inline followed by the remaining arguments, for 
+ *     example ProcurePartially(object, Guide<void, int>, bound).  The guide
+ *     specifies the remaining parameter types, so it precedes the bound 
+ *     arguments.  Functions may also be specified.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ * @tparam ...Propagational
+ *     Types of the bound arguments, deduced as forwarding references.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @param[in] ...bounds
+ *     Bound arguments which are copied if they are lvalues, otherwise they
+ *     are moved.  They are stored by their decayed type, so arrays are 
+ *     stored as pointers and functions as function pointers.
+ * @return
+ *     Procedural object which references object and stores bounds.
+ */
+template <class Typical, class Resultant, class... Parametric, class... Propagational>
+static constexpr PartiallyObjective<Typical, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>
+ProcurePartially(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide,
+    Propagational&&...
+        bounds)
+{
+    using Specific = PartiallyObjective<Typical, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>;
+    return Specific(object, static_cast<Propagational&&>(bounds)...);
+}
+
+/**
+ * @brief         
+ *     Specify an object member function with leading bound arguments as a
+ *     procedural call object.
+ * @details       
+ *     This function template is used to create a representation of a 
+ *     procedural call to an object member function, which is called with
+ *     bound arguments stored inline followed by the remaining arguments, 
+ *     for example ProcurePartially(object, &Class::member, Guide<void>, 
+ *     bound).  Define the macro PROCEDURE_MODULE_NOSTDCPP to prevent 
+ *     static assertions if the type_traits standard library header is not
+ *     available.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Classified
+ *     Class type of the member function, which is deduced separately from
+ *     Typical so that a function bound first is not taken as a method.
+ * @tparam Memberwise
+ *     Member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ * @tparam ...Propagational
+ *     Types of the bound arguments, deduced as forwarding references.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] method
+ *     Pointer to the member function which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @param[in] ...bounds
+ *     Bound arguments which are copied if they are lvalues, otherwise they
+ *     are moved.  They are stored by their decayed type, so arrays are 
+ *     stored as pointers and functions as function pointers.
+ * @return
+ *     Procedural object which references object and method and stores 
+ *     bounds.
+ */
+template <class Typical, class Classified, class Memberwise, class Resultant, class... Parametric, class... Propagational>
+static constexpr PartiallyMethodic<Typical, Memberwise Classified::*, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>
+ProcurePartially(
+    Typical&
+        object,
+    Memberwise Classified::* const
+        method,
+    Functional<Resultant, Parametric...>*
+        guide,
+    Propagational&&...
+        bounds)
+{
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    static_assert(
+        ::std::is_member_function_pointer<Memberwise Classified::*>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+    using Specific = PartiallyMethodic<Typical, Memberwise Classified::*, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>;
+    return Specific(object, method, static_cast<Propagational&&>(bounds)...);
+}
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief         
+ *     Specify a callable object with leading bound arguments as a 
+ *     comparable procedural call object.
+ * @details       
+ *     This function template is the same as ProcurePartially, except that
+ *     the procedure is comparable, which requires the bound argument types
+ *     to have equal to and less than operators.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ * @tparam ...Propagational
+ *     Types of the bound arguments, deduced as forwarding references.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @param[in] ...bounds
+ *     Bound arguments which are copied if they are lvalues, otherwise they
+ *     are moved.  They are stored by their decayed type, so arrays are 
+ *     stored as pointers and functions as function pointers.
+ * @return
+ *     Comparable procedural object which references object and stores 
+ *     bounds.
+ */
+template <class Typical, class Resultant, class... Parametric, class... Propagational>
+static constexpr ComparablyPartiallyObjective<Typical, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>
+ProcureComparablyPartially(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide,
+    Propagational&&...
+        bounds)
+{
+    using Specific = ComparablyPartiallyObjective<Typical, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>;
+    return Specific(object, static_cast<Propagational&&>(bounds)...);
+}
+
+/**
+ * @brief         
+ *     Specify an object member function with leading bound arguments as a
+ *     comparable procedural call object.
+ * @details       
+ *     This function template is the same as ProcurePartially, except that
+ *     the procedure is comparable, which requires the bound argument types
+ *     to have equal to and less than operators.  Define the macro 
+ *     PROCEDURE_MODULE_NOSTDCPP to prevent static assertions if the 
+ *     type_traits standard library header is not available.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Classified
+ *     Class type of the member function, which is deduced separately from
+ *     Typical so that a function bound first is not taken as a method.
+ * @tparam Memberwise
+ *     Member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the remaining parameter types.
+ * @tparam ...Propagational
+ *     Types of the bound arguments, deduced as forwarding references.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] method
+ *     Pointer to the member function which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @param[in] ...bounds
+ *     Bound arguments which are copied if they are lvalues, otherwise they
+ *     are moved.  They are stored by their decayed type, so arrays are 
+ *     stored as pointers and functions as function pointers.
+ * @return
+ *     Comparable procedural object which references object and method and
+ *     stores bounds.
+ */
+template <class Typical, class Classified, class Memberwise, class Resultant, class... Parametric, class... Propagational>
+static constexpr ComparablyPartiallyMethodic<Typical, Memberwise Classified::*, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>
+ProcureComparablyPartially(
+    Typical&
+        object,
+    Memberwise Classified::* const
+        method,
+    Functional<Resultant, Parametric...>*
+        guide,
+    Propagational&&...
+        bounds)
+{
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    static_assert(
+        ::std::is_member_function_pointer<Memberwise Classified::*>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+    using Specific = ComparablyPartiallyMethodic<Typical, Memberwise Classified::*, Bound<typename Decayed<Propagational>::Type...>, Resultant, Parametric...>;
+    return Specific(object, method, static_cast<Propagational&&>(bounds)...);
+}
+#endif
+
+/**
+ * @brief
+ *     Class for calling the composition of two procedures.
+ * @details
+ *     This type is used to call an outer procedure with the result of an 
+ *     inner procedure, which is called with the arguments of the call.  
+ *     Both are referenced, so they must outlive this object.  The result 
+ *     of the inner procedure is passed directly as the argument of the 
+ *     outer procedure, so no intermediate copy is stored.  If the outer 
+ *     and inner types are concrete procedure types, such as those returned
+ *     by Procure, their final call operators are called directly and the 
+ *     compiler may inline the whole composition, otherwise each is a 
+ *     virtual call.  Compositions may themselves be composed to form a 
+ *     pipeline.
+ * @tparam Outer
+ *     Type of the outer procedure, called with the inner result.
+ * @tparam Inner
+ *     Type of the inner procedure, called with the arguments.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Outer, class Inner, class Resultant, class... Parametric>
+class Compositional : public Procedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Construct a composition of procedure references.
+     * @param[in] outer
+     *     The procedure which is called with the inner result.
+     * @param[in] inner
+     *     The procedure which is called with the arguments.
+     */
+    constexpr Compositional(const Outer& outer, const Inner& inner)
+        : Procedural<Resultant, Parametric...>(this)
+        , outer(outer)
+        , inner(inner)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural composition call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the outer 
+     *     procedure with the result of calling the inner procedure and 
+     *     returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded to the inner 
+     *     procedure.
+     * @return
+     *     The return result of the outer call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return outer(inner(static_cast<Parametric&&>(arguments)...));
+    }
+
+private:
+    const Outer& outer; /**< Outer procedure. */
+
+    const Inner& inner; /**< Inner procedure. */
+};
+
+/**
+ * @brief         
+ *     Compose two procedures as a procedural call object.
+ * @details       
+ *     This function template is used to create a representation of a 
+ *     procedural call to outer with the result of inner, for example
+ *     Compose(format, parse, Guide<void, const char*>).  Outer and inner 
+ *     may be any procedures or callable objects with constant call 
+ *     operators, where concrete types may be inlined and Procedural 
+ *     references are called virtually.
+ * @tparam Outer
+ *     Type of the outer procedure.
+ * @tparam Inner
+ *     Type of the inner procedure.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] outer
+ *     Reference to the procedure which is called with the inner result.
+ * @param[in] inner
+ *     Reference to the procedure which is called with the arguments.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Procedural object which references outer and inner.
+ */
+template <class Outer, class Inner, class Resultant, class... Parametric>
+static constexpr Compositional<Outer, Inner, Resultant, Parametric...>
+Compose(
+    const Outer&
+        outer,
+    const Inner&
+        inner,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = Compositional<Outer, Inner, Resultant, Parametric...>;
+    return Specific(outer, inner);
+}
+
+/**
+ * @brief
+ *     Overloaded call declaration.
+ * @tparam Specific
+ *     Most derived overloaded procedure type.
+ * @tparam Signature
+ *     Function type of the call.
+ */
+template <class Specific, class Signature>
+class Overloading;
+
+/**
+ * @brief
+ *     Class for calling one signature of an overloaded procedure.
+ * @details
+ *     This type implements the Procedural base of one signature of an 
+ *     Overloaded procedure, by calling the object which it references.
+ * @tparam Specific
+ *     Most derived overloaded procedure type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Specific, class Resultant, class... Parametric>
+class Overloading<Specific, Resultant(Parametric...)> : public Procedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Construct the procedural base of one signature.
+     */
+    constexpr Overloading()
+        : Procedural<Resultant, Parametric...>(this)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a copy of the procedural base of one signature.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    constexpr Overloading(const Overloading& copy)
+        : Procedural<Resultant, Parametric...>(this)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural overload call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the object 
+     *     of the overloaded procedure by reference and returning it's 
+     *     result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return static_cast<const Specific&>(*this).object(static_cast<Parametric&&>(arguments)...);
+    }
+};
+
+/**
+ * @brief
+ *     Class for calling any callable object with several signatures.
+ * @details
+ *     This type is used to call an object which has several call 
+ *     operators, such as a visitor, through one Procedural base per 
+ *     signature, while referencing the object only once.  It has one 
+ *     virtual table pointer per signature in a single virtual table 
+ *     group, so it is smaller than a separate procedure per signature, 
+ *     and converting it to the Procedural reference of another signature
+ *     is a constant pointer adjustment.  Calls directly on an instance are
+ *     ambiguous, so it is called through the Procedural reference of a 
+ *     signature.  The signatures must be distinct.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam ...Signatures
+ *     Function types of the calls.
+ */
+template <class Typical, class... Signatures>
+class Overloaded : public Overloading<Overloaded<Typical, Signatures...>, Signatures>... {
+
+public:
+    /** 
+     * @brief         
+     *     Construct a callable object reference.
+     * @param[in] object
+     *     The callable object which will be called by reference.
+     */
+    constexpr Overloaded(Typical& object)
+        : object(object)
+    {
+    }
+
+    Typical& object; /**< Callable object reference. */
+};
+
+/**
+ * @brief         
+ *     Specify a callable object with several signatures as one procedural
+ *     call object.
+ * @details       
+ *     This function template is used to create one representation of the 
+ *     procedural calls of every guided signature of a callable object, for
+ *     example Overload(visitor, Guide<void, A>, Guide<void, B>), where the
+ *     result may be passed as a Procedural of any of the signatures.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam ...Signatures
+ *     Function type of each call, deduced from the guides.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] ...guides
+ *     Used for template argument deduction, values are ignored.
+ * @return
+ *     Procedural object which references object.
+ */
+template <class Typical, class... Signatures>
+static constexpr Overloaded<Typical, Signatures...>
+Overload(
+    Typical&
+        object,
+    Signatures*...
+        guides)
+{
+    using Specific = Overloaded<Typical, Signatures...>;
+    return Specific(object);
+}
+
+/**
+ * @brief
+ *     Type index within a type list.
+ * @details
+ *     This class template provides the index of Specific within the list
+ *     ...Specifics as the index member.  It is undefined if Specific is not
+ *     in the list, so using it fails to compile.
+ * @tparam Specific
+ *     Type which is indexed.
+ * @tparam ...Specifics
+ *     Type list which is searched.
+ */
+template <class Specific, class... Specifics>
+struct Indicial;
+
+/**
+ * @brief
+ *     Type index specialization where the first type matches.
+ */
+template <class Specific, class... Specifics>
+struct Indicial<Specific, Specific, Specifics...> {
+    static constexpr Cardinal index = 0; /**< Index of Specific. */
+};
+
+/**
+ * @brief
+ *     Type index specialization where the first type does not match.
+ */
+template <class Specific, class Other, class... Specifics>
+struct Indicial<Specific, Other, Specifics...> {
+    static constexpr Cardinal index = 1 + Indicial<Specific, Specifics...>::index; /**< Index of Specific. */
+};
+
+/**
+ * @brief
+ *     Largest size within a type list.
+ * @details
+ *     This class template provides the largest size of the types in the 
+ *     list as the size member.
+ * @tparam Specific
+ *     First type in the list.
+ * @tparam ...Specifics
+ *     Remaining types in the list.
+ */
+template <class Specific, class... Specifics>
+struct Dimensional {
+    static constexpr Cardinal size = sizeof(Specific) > Dimensional<Specifics...>::size ? sizeof(Specific) : Dimensional<Specifics...>::size; /**< Largest size. */
+};
+
+/**
+ * @brief
+ *     Largest size specialization for the last type in a list.
+ */
+template <class Specific>
+struct Dimensional<Specific> {
+    static constexpr Cardinal size = sizeof(Specific); /**< Largest size. */
+};
+
+/**
+ * @brief
+ *     Closed set procedure declaration.
+ * @tparam Signature
+ *     Function type of the call.
+ * @tparam ...Specifics
+ *     Procedure types which may be stored.
+ */
+template <class Signature, class... Specifics>
+class Alternative;
+
+/**
+ * @brief
+ *     Procedure which is one of a closed set of procedure types.
+ * @details
+ *     This type stores a copy of one procedure object of the listed types
+ *     inline, such as those returned by Procure, along with its index in
+ *     the list.  Calls select the stored type by comparing the index 
+ *     against each type in turn and call its final call operator directly,
+ *     so the compiler may inline the call rather than make a virtual call.
+ *     An instance is constructed from any of the listed types, so the 
+ *     Guide deduction of Procure is used to create it, for example 
+ *     Alternative<void(), A, B> procedure = Procure(object, Guide<void>).
+ *     Define the macro PROCEDURE_MODULE_NOSTDCPP to prevent static 
+ *     assertions if the type_traits standard library header is not 
+ *     available.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @tparam ...Specifics
+ *     Procedure types which may be stored, which must be derived from 
+ *     Procedural and trivially destructible.
+ */
+template <class Resultant, class... Parametric, class... Specifics>
+class Alternative<Resultant(Parametric...), Specifics...> {
+
+public:
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using BaseProcedural = Procedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameAlternative = Alternative<Resultant(Parametric...), Specifics...>;
+
+    /**
+     * @brief
+     *     Construct a copy of a procedure of one of the listed types.
+     * @tparam Specific
+     *     Type of the procedure, which must be one of the listed types.
+     * @param[in] procedure
+     *     The procedure object which will be copied.
+     */
+    template <class Specific>
+    Alternative(const Specific& procedure)
+        : alternative(Indicial<Specific, Specifics...>::index)
+    {
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+        static_assert(
+            ::std::is_base_of<BaseProcedural, Specific>::value,
+            "Specific: Procedural derived type required");
+        static_assert(
+            ::std::is_trivially_destructible<Specific>::value,
+            "Specific: Trivially destructible procedure object required");
+#endif
+        static_assert(
+            alignof(Specific) <= alignof(long double),
+            "Specific: Procedure object alignment exceeds the inline storage");
+        new (storage) Specific(procedure);
+    }
+
+    /**
+     * @brief
+     *     Construct a copy of a closed set procedure.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    Alternative(const SameAlternative& copy)
+        : alternative(copy.alternative)
+    {
+        Copy<0, Specifics...>(copy);
+    }
+
+    /**
+     * @brief
+     *     Copy assignment operator.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     * @return
+     *     Reference to this instance.
+     */
+    SameAlternative& operator=(const SameAlternative& copy)
+    {
+        alternative = copy.alternative;
+        Copy<0, Specifics...>(copy);
+        return *this;
+    }
+
+    /**
+     * @brief
+     *     Index of the stored procedure type.
+     * @return
+     *     Index of the stored type within the listed types.
+     */
+    constexpr Cardinal index() const
+    {
+        return alternative;
+    }
+
+    /**
+     * @brief
+     *     Procedural base conversion.
+     * @details
+     *     Allows the stored procedure to be passed wherever a Procedural
+     *     reference is expected, which is then called virtually.
+     * @return
+     *     Reference to the stored procedure.
+     */
+    operator const BaseProcedural&() const
+    {
+        return Base<0, Specifics...>();
+    }
+
+    /**
+     * @brief
+     *     Call operator.
+     * @details
+     *     Calls the stored procedure without a virtual call and returns its
+     *     result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const
+    {
+        return Call<0, Specifics...>(static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    template <class Specific>
+    const Specific& Located() const
+    {
+        return *reinterpret_cast<const Specific*>(storage);
+    }
+
+    template <Cardinal index, class Specific>
+    Resultant Call(Parametric... arguments) const
+    {
+        return Located<Specific>()(static_cast<Parametric&&>(arguments)...);
+    }
+
+    template <Cardinal index, class Specific, class Next, class... Others>
+    Resultant Call(Parametric... arguments) const
+    {
+        if (alternative == index)
+            return Located<Specific>()(static_cast<Parametric&&>(arguments)...);
+        return Call<index + 1, Next, Others...>(static_cast<Parametric&&>(arguments)...);
+    }
+
+    template <Cardinal index, class Specific>
+    const BaseProcedural& Base() const
+    {
+        return Located<Specific>();
+    }
+
+    template <Cardinal index, class Specific, class Next, class... Others>
+    const BaseProcedural& Base() const
+    {
+        if (alternative == index)
+            return Located<Specific>();
+        return Base<index + 1, Next, Others...>();
+    }
+
+    template <Cardinal index, class Specific>
+    void Copy(const SameAlternative& copy)
+    {
+        new (storage) Specific(copy.template Located<Specific>());
+    }
+
+    template <Cardinal index, class Specific, class Next, class... Others>
+    void Copy(const SameAlternative& copy)
+    {
+        if (alternative == index)
+            new (storage) Specific(copy.template Located<Specific>());
+        else
+            Copy<index + 1, Next, Others...>(copy);
+    }
+
+    alignas(long double) unsigned char storage[Dimensional<Specifics...>::size]; /**< Inline storage. */
+
+    Cardinal alternative; /**< Index of the stored type. */
+};
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief
+ *     Abstract possessed procedural base class.
+ * @details
+ *     This type is used by the Possessive class to copy, move and destroy a
+ *     callable object which it stores, in addition to calling it. 
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+class Possessional : public Procedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Virtual destructor.
+     * @details
+     *     Destroys the possessed callable object.
+     */
+    virtual ~Possessional() {}
+
+    /**
+     * @brief
+     *     Pure virtual copy construction.
+     * @details
+     *     This function must construct a copy of this instance at location.
+     * @param[in] location
+     *     Storage suitable for an instance of the derived class.
+     * @return
+     *     The copy which was constructed at location.
+     */
+    virtual Possessional* copy(void* location) const = 0;
+
+    /**
+     * @brief
+     *     Pure virtual move construction.
+     * @details
+     *     This function must move construct an instance at location from
+     *     this instance, which must still be destroyed afterwards.
+     * @param[in] location
+     *     Storage suitable for an instance of the derived class.
+     * @return
+     *     The instance which was constructed at location.
+     */
+    virtual Possessional* move(void* location) = 0;
+};
+
+/**
+ * @brief
+ *     Class for possessing, copying and calling any callable object.
+ * @details
+ *     This type is used to store a callable object by value, rather than by
+ *     reference as with SimplyObjective.  The call operator of the callable
+ *     object is called even if it is not constant, as is the case with a
+ *     reference to a callable object.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class Resultant, class... Parametric>
+class PossessivelyObjective : public Possessional<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameObjective = PossessivelyObjective<Typical, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using BasePossessional = Possessional<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct a callable object copy.
+     * @param[in] object
+     *     The callable object which will be copied.
+     */
+    constexpr PossessivelyObjective(const Typical& object)
+        : object(object)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a callable object by moving it.
+     * @param[in] object
+     *     The callable object which will be moved.
+     */
+    constexpr PossessivelyObjective(Typical&& object)
+        : object(static_cast<Typical&&>(object))
+    {
+    }
+
+    /**
+     * @brief
+     *     Procedural object call operator.
+     * @details
+     *     Implements the procedural call operator by calling the possessed
+     *     object and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return object(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Possessional copy construction.
+     * @param[in] location
+     *     Storage suitable for an instance of this class.
+     * @return
+     *     The copy which was constructed at location.
+     */
+    BasePossessional* copy(void* location) const final
+    {
+        return new (location) SameObjective(object);
+    }
+
+    /**
+     * @brief
+     *     Possessional move construction.
+     * @param[in] location
+     *     Storage suitable for an instance of this class.
+     * @return
+     *     The instance which was constructed at location.
+     */
+    BasePossessional* move(void* location) final
+    {
+        return new (location) SameObjective(static_cast<Typical&&>(object));
+    }
+
+private:
+    mutable Typical object; /**< Possessed callable object. */
+};
+
+/**
+ * @brief
+ *     Owning procedural value type with fixed inline storage.
+ * @details
+ *     This type is used to copy or move any callable object into storage
+ *     which is contained in the instance itself, so that the callable object
+ *     need not outlive the procedure and no heap allocation is ever made.
+ *     Construction from a callable object which does not fit the capacity 
+ *     fails to compile.  Procure results can also be possessed, which is how
+ *     member functions are represented.  Calling an empty instance is 
+ *     undefined.  Define the macro PROCEDURE_MODULE_NOSTDCPP only if placement
+ *     new is declared before this header is included.
+ * @tparam Capacity
+ *     Size in bytes of the inline storage, which must hold the callable 
+ *     object together with one virtual table pointer.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <Cardinal Capacity, class Resultant, class... Parametric>
+class Possessive {
+
+public:
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using BaseProcedural = Procedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Possessional class type template instance alias.
+     */
+    using BasePossessional = Possessional<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SamePossessive = Possessive<Capacity, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an empty procedure.
+     */
+    constexpr Possessive()
+        : procedure(0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a procedure which possesses a function pointer.
+     * @param[in] function
+     *     Reference to the function which will be called.
+     */
+    Possessive(Functional<Resultant, Parametric...>& function)
+        : procedure(Possess<Functional<Resultant, Parametric...>*>(&function))
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a procedure which possesses a copy of a callable object.
+     * @tparam Typical
+     *     Type of the callable object.
+     * @param[in] object
+     *     The callable object which will be copied.
+     */
+    template <class Typical>
+    Possessive(const Typical& object)
+        : procedure(Possess<Typical>(object))
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a procedure which possesses a callable object.
+     * @details
+     *     The callable object is copied if it is an lvalue, otherwise it is
+     *     moved.
+     * @tparam Typical
+     *     Type of the callable object, deduced as a forwarding reference.
+     * @param[in] object
+     *     The callable object which will be possessed.
+     */
+    template <class Typical>
+    Possessive(Typical&& object)
+        : procedure(Possess<typename Unreferenced<Typical>::Type>(static_cast<Typical&&>(object)))
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a copy of a procedure.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    Possessive(const SamePossessive& copy)
+        : procedure(copy.procedure ? copy.procedure->copy(storage) : 0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a copy of a procedure.
+     * @details
+     *     This overload prevents a non constant instance from being possessed
+     *     as a callable object rather than copied.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    Possessive(SamePossessive& copy)
+        : Possessive(static_cast<const SamePossessive&>(copy))
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a procedure by moving the callable object of another.
+     * @details
+     *     The other instance still possesses its moved from callable object.
+     * @param[in] move
+     *     The instance of this class to move from.
+     */
+    Possessive(SamePossessive&& move)
+        : procedure(move.procedure ? move.procedure->move(storage) : 0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Destroy the possessed callable object.
+     */
+    ~Possessive()
+    {
+        clear();
+    }
+
+    /**
+     * @brief
+     *     Copy assignment operator.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     * @return
+     *     Reference to this instance.
+     */
+    SamePossessive& operator=(const SamePossessive& copy)
+    {
+        if (&copy != this) {
+            clear();
+            procedure = copy.procedure ? copy.procedure->copy(storage) : 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief
+     *     Move assignment operator.
+     * @param[in] move
+     *     The instance of this class to move from.
+     * @return
+     *     Reference to this instance.
+     */
+    SamePossessive& operator=(SamePossessive&& move)
+    {
+        if (&move != this) {
+            clear();
+            procedure = move.procedure ? move.procedure->move(storage) : 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief
+     *     Destroy the possessed callable object, leaving this empty.
+     */
+    void clear()
+    {
+        if (procedure)
+            procedure->~BasePossessional();
+        procedure = 0;
+    }
+
+    /**
+     * @brief
+     *     Determine whether a callable object is possessed.
+     * @return
+     *     True only if this instance is not empty.
+     */
+    constexpr explicit operator bool() const
+    {
+        return procedure != 0;
+    }
+
+    /**
+     * @brief
+     *     Procedural interface conversion operator.
+     * @return
+     *     Reference to the procedural interface of the possessed object.
+     */
+    constexpr operator const BaseProcedural&() const
+    {
+        return *procedure;
+    }
+
+    /**
+     * @brief
+     *     Call operator.
+     * @details
+     *     Calls the possessed callable object with one virtual call.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const
+    {
+        return (*procedure)(static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    template <class Typical, class Propagational>
+    BasePossessional* Possess(Propagational&& object)
+    {
+        using Specific = PossessivelyObjective<Typical, Resultant, Parametric...>;
+        static_assert(
+            sizeof(Specific) <= Capacity,
+            "Capacity: Callable object does not fit the inline storage");
+        static_assert(
+            alignof(Specific) <= alignof(long double),
+            "Typical: Callable object alignment exceeds the inline storage");
+        return new (storage) Specific(static_cast<Propagational&&>(object));
+    }
+
+    alignas(long double) unsigned char storage[Capacity]; /**< Inline storage. */
+
+    BasePossessional* procedure; /**< Possessed object located in storage. */
+};
+#endif
+
+/**
+ * @brief
+ *     Non virtual procedural delegate class.
+ * @details
+ *     This type is used to call any procedure matching the specified return
+ *     and parameter types through a context pointer and a trampoline function
+ *     pointer, rather than through a virtual call operator.  It is trivially
+ *     copyable, is the size of two pointers and can be stored in arrays by 
+ *     value.  Instances are created using the ProcureThinly templates, which
+ *     generate one trampoline function per callable object type or member 
+ *     function.  Function contexts are stored by converting the function 
+ *     pointer to a void pointer, which is conditionally supported by C++.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+class ThinlyProcedural {
+
+public:
+    /**
+     * @brief
+     *     Trampoline function type.
+     */
+    using Trampolinic = Resultant(void*, Parametric...);
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameProcedural = ThinlyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an uninitialized delegate.
+     * @details
+     *     Calling an uninitialized delegate is undefined.
+     */
+    ThinlyProcedural() = default;
+
+    /**
+     * @brief
+     *     Construct a delegate from a context and trampoline.
+     * @param[in] context
+     *     Pointer which is passed to the trampoline with each call.
+     * @param[in] trampoline
+     *     Function which calls the procedure represented by context.
+     */
+    constexpr ThinlyProcedural(void* context, Trampolinic& trampoline)
+        : context(context)
+        , trampoline(&trampoline)
+    {
+    }
+
+    /**
+     * @brief
+     *     Call operator.
+     * @details
+     *     Calls the trampoline function with the context pointer and returns
+     *     its result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const
+    {
+        return trampoline(context, static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Equal to operator.
+     * @param[in] relative
+     *     Delegate to be compared equal to.
+     * @return
+     *     True only if both have the same context and trampoline.
+     */
+    constexpr bool operator==(const SameProcedural& relative) const
+    {
+        return context == relative.context && trampoline == relative.trampoline;
+    }
+
+    /**
+     * @brief
+     *     Not equal to operator.
+     * @param[in] relative
+     *     Delegate to be compared not equal to.
+     * @return
+     *     False only if both have the same context and trampoline.
+     */
+    constexpr bool operator!=(const SameProcedural& relative) const
+    {
+        return !operator==(relative);
+    }
+
+private:
+    void* context; /**< Object or function address. */
+
+    Trampolinic* trampoline; /**< Context specific call function. */
+};
+
+/**
+ * @brief
+ *     Trampoline functions for delegates to functions.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+struct ThinlyFunctional {
+
+    /**
+     * @brief
+     *     Call the function located by context.
+     * @param[in] context
+     *     Function pointer converted to a void pointer.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    static Resultant Call(void* context, Parametric... arguments)
+    {
+        using Locational = Functional<Resultant, Parametric...>*;
+        return reinterpret_cast<Locational>(context)(static_cast<Parametric&&>(arguments)...);
+    }
+};
+
+/**
+ * @brief
+ *     Trampoline functions for delegates to callable objects.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class Resultant, class... Parametric>
+struct ThinlyObjective {
+
+    /**
+     * @brief
+     *     Call the object located by context.
+     * @param[in] context
+     *     Address of the callable object.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    static Resultant Call(void* context, Parametric... arguments)
+    {
+        return (*static_cast<Typical*>(context))(static_cast<Parametric&&>(arguments)...);
+    }
+};
+
+/**
+ * @brief
+ *     Trampoline functions for delegates to object member functions.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam method
+ *     Pointer to the member function which will be called.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class MethodLocational, MethodLocational method, class Resultant, class... Parametric>
+struct ThinlyMethodic {
+
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    static_assert(
+        ::std::is_member_function_pointer<MethodLocational>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+
+    /**
+     * @brief
+     *     Call the member function of the object located by context.
+     * @param[in] context
+     *     Address of the object.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    static Resultant Call(void* context, Parametric... arguments)
+    {
+        return (static_cast<Typical*>(context)->*method)(static_cast<Parametric&&>(arguments)...);
+    }
+};
+
+/**
+ * @brief
+ *     Trampoline functions for delegates to functions specified as template
+ *     arguments.
+ * @details
+ *     Since the function is part of the trampoline rather than the context,
+ *     delegates using it can be created in constant expressions.
+ * @tparam FunctionLocational
+ *     Pointer to function type.
+ * @tparam function
+ *     Pointer to the function which will be called.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class FunctionLocational, FunctionLocational function, class Resultant, class... Parametric>
+struct ThinlyStatical {
+
+    /**
+     * @brief
+     *     Call the function, ignoring context.
+     * @param[in] context
+     *     Unused, always null.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    static Resultant Call(void* context, Parametric... arguments)
+    {
+        return function(static_cast<Parametric&&>(arguments)...);
+    }
+};
+
+/**
+ * @brief
+ *     Specify a function as a delegate.
+ * @details
+ *     This function template is used to create a non virtual representation
+ *     of a procedural call to a function.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] function
+ *     Reference to the function which will be called.
+ * @return
+ *     Delegate which references function.
+ */
+template <class Resultant, class... Parametric>
+static ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Functional<Resultant, Parametric...>&
+        function)
+{
+    using Specific = ThinlyProcedural<Resultant, Parametric...>;
+    using Trampoline = ThinlyFunctional<Resultant, Parametric...>;
+    return Specific(reinterpret_cast<void*>(&function), Trampoline::Call);
+}
+
+/**
+ * @brief
+ *     Specify a function as a delegate with a guide.
+ * @details
+ *     This function template is used to create a non virtual representation
+ *     of a procedural call to a function, where the guide must match the 
+ *     function type.  It allows functions to be used wherever callable 
+ *     objects are used with a guide.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] function
+ *     Reference to the function which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which references function.
+ */
+template <class Resultant, class... Parametric>
+static ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Functional<Resultant, Parametric...>&
+        function,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    return ProcureThinly(function);
+}
+
+/**
+ * @brief
+ *     Specify a callable object as a delegate.
+ * @details
+ *     This function template is used to create a non virtual representation
+ *     of a procedural call to any callable object.  This overload is used 
+ *     for lambda objects and user defined class call operator objects.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which references object.
+ */
+template <class Typical, class Resultant, class... Parametric>
+static constexpr ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = ThinlyProcedural<Resultant, Parametric...>;
+    using Trampoline = ThinlyObjective<Typical, Resultant, Parametric...>;
+    return Specific(const_cast<void*>(static_cast<const volatile void*>(&object)), Trampoline::Call);
+}
+
+/**
+ * @brief
+ *     Specify an object member function as a delegate.
+ * @details
+ *     This function template is used to create a non virtual representation
+ *     of a procedural call to an object member function.  The member 
+ *     function is specified as a template argument so that it is part of 
+ *     the trampoline function rather than the delegate, for example 
+ *     ProcureThinly<decltype(&Class::member), &Class::member>(object, guide).
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam method
+ *     Pointer to the member function which will be called.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which references object and method.
+ */
+template <class MethodLocational, MethodLocational method, class Typical, class Resultant, class... Parametric>
+static constexpr ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = ThinlyProcedural<Resultant, Parametric...>;
+    using Trampoline = ThinlyMethodic<Typical, MethodLocational, method, Resultant, Parametric...>;
+    return Specific(const_cast<void*>(static_cast<const volatile void*>(&object)), Trampoline::Call);
+}
+
+#ifdef __cpp_nontype_template_parameter_auto
+/**
+ * @brief
+ *     Specify an object member function as a delegate.
+ * @details
+ *     This function template is the same as the above, except that the 
+ *     pointer to member function type is deduced from method, for example
+ *     ProcureThinly<&Class::member>(object, guide).
+ * @tparam method
+ *     Pointer to the member function which will be called.
+ * @tparam Typical
+ *     Type of the data object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object for the member function call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which references object and method.
+ */
+template <auto method, class Typical, class Resultant, class... Parametric>
+static constexpr ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    return ProcureThinly<decltype(method), method>(object, guide);
+}
+#endif
+
+/**
+ * @brief
+ *     Specify a function as a delegate in a constant expression.
+ * @details
+ *     This function template is used to create a non virtual representation
+ *     of a procedural call to a function, which is specified as a template 
+ *     argument so that it is part of the trampoline function rather than the
+ *     delegate, for example ProcureThinly<decltype(&function), &function>(guide).
+ *     Unlike the overloads which take a function reference it can be used
+ *     in constant expressions, such as the initializer of a Tabular object.
+ * @tparam FunctionLocational
+ *     Pointer to function type.
+ * @tparam function
+ *     Pointer to the function which will be called.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which calls function.
+ */
+template <class FunctionLocational, FunctionLocational function, class Resultant, class... Parametric>
+static constexpr ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = ThinlyProcedural<Resultant, Parametric...>;
+    using Trampoline = ThinlyStatical<FunctionLocational, function, Resultant, Parametric...>;
+    return Specific(0, Trampoline::Call);
+}
+
+#ifdef __cpp_nontype_template_parameter_auto
+/**
+ * @brief
+ *     Specify a function as a delegate in a constant expression.
+ * @details
+ *     This function template is the same as the above, except that the 
+ *     pointer to function type is deduced from function, for example
+ *     ProcureThinly<&function>(guide).
+ * @tparam function
+ *     Pointer to the function which will be called.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Delegate which calls function.
+ */
+template <auto function, class Resultant, class... Parametric>
+static constexpr ThinlyProcedural<Resultant, Parametric...>
+ProcureThinly(
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    return ProcureThinly<decltype(function), function>(guide);
+}
+#endif
+
+/**
+ * @brief
+ *     Class for calling a delegate through the procedural interface.
+ * @details
+ *     This type is used to pass a ThinlyProcedural delegate wherever a 
+ *     Procedural reference is expected.  Unlike the types returned by 
+ *     Procure, it does not depend on the type of the callable object, so 
+ *     every instance of one signature shares one virtual table, and each 
+ *     callable type only adds the trampoline function of its delegate.  
+ *     This reduces the instantiations, virtual tables and type information
+ *     of code with many distinct callable types, at the cost of an 
+ *     indirect call through the trampoline after the virtual call.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+class DelegatingProcedural : public Procedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Delegate type template instance alias.
+     */
+    using SameDelegate = ThinlyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct a procedure which calls a delegate.
+     * @param[in] delegate
+     *     The delegate which will be copied.
+     */
+    constexpr DelegatingProcedural(const SameDelegate& delegate)
+        : Procedural<Resultant, Parametric...>(this)
+        , delegate(delegate)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct a copy of a procedure which calls a delegate.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    constexpr DelegatingProcedural(const DelegatingProcedural& copy)
+        : Procedural<Resultant, Parametric...>(this)
+        , delegate(copy.delegate)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural delegate call operator.
+     * @details       
+     *     Implements the procedural call operator by calling the delegate 
+     *     and returning it's result to the calling context.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        return delegate(static_cast<Parametric&&>(arguments)...);
+    }
+
+private:
+    SameDelegate delegate; /**< Called delegate. */
+};
+
+/**
+ * @brief         
+ *     Specify a delegate as a procedural call object.
+ * @details       
+ *     This function template is used to create a representation of a 
+ *     procedural call to a delegate which shares its virtual table with 
+ *     every other of the same signature, for example
+ *     Procure(ProcureThinly(object, Guide<void, int>)).
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] delegate
+ *     The delegate which will be copied.
+ * @return
+ *     Procedural object which calls delegate.
+ */
+template <class Resultant, class... Parametric>
+static constexpr DelegatingProcedural<Resultant, Parametric...>
+Procure(
+    const ThinlyProcedural<Resultant, Parametric...>&
+        delegate)
+{
+    using Specific = DelegatingProcedural<Resultant, Parametric...>;
+    return Specific(delegate);
+}
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+/**
+ * @brief
+ *     Class for calling or comparing a delegate through the procedural 
+ *     interface.
+ * @details
+ *     This type is the comparable form of DelegatingProcedural, so every
+ *     instance of one signature shares one virtual table.  Instances are
+ *     equal if their delegates are equal, and are ordered and hashed by 
+ *     the bytes of their delegates.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+class ComparablyDelegatingProcedural : public ComparablyProcedural<Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class type template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameDelegating = ComparablyDelegatingProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Delegate type template instance alias.
+     */
+    using SameDelegate = ThinlyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct a procedure which calls a delegate.
+     * @param[in] delegate
+     *     The delegate which will be copied.
+     */
+    constexpr ComparablyDelegatingProcedural(const SameDelegate& delegate)
+        : delegate(delegate)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural delegate call operator.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        return delegate(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Equal to operator.
+     * @param[in] relative
+     *     Procedure to be compared equal to.
+     * @return
+     *     True only if both are delegating procedures of equal delegates.
+     */
+    bool operator==(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return false;
+        return delegate == static_cast<const SameDelegating&>(relative).delegate;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameDelegating>::tag;
+    }
+
+    /**
+     * @brief
+     *     Hash of the delegate.
+     * @return
+     *     Digest of the identity and delegate.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return Digest(&delegate, sizeof(delegate), Digest(&identity, sizeof(identity)));
+    }
+
+    /**
+     * @brief
+     *     Less than operator.
+     * @param[in] relative
+     *     Procedure to be compared less than.
+     * @return
+     *     True only if this procedure is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        return Collate(&delegate, &static_cast<const SameDelegating&>(relative).delegate, sizeof(delegate)) < 0;
+    }
+
+private:
+    SameDelegate delegate; /**< Called delegate. */
+};
+
+/**
+ * @brief         
+ *     Specify a delegate as a comparable procedural call object.
+ * @details       
+ *     This function template is used to create a comparable 
+ *     representation of a procedural call to a delegate which shares its
+ *     virtual table with every other of the same signature, for example
+ *     ProcureComparably(ProcureThinly(object, Guide<void, int>)).
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] delegate
+ *     The delegate which will be copied.
+ * @return
+ *     Comparable procedural object which calls delegate.
+ */
+template <class Resultant, class... Parametric>
+static constexpr ComparablyDelegatingProcedural<Resultant, Parametric...>
+ProcureComparably(
+    const ThinlyProcedural<Resultant, Parametric...>&
+        delegate)
+{
+    using Specific = ComparablyDelegatingProcedural<Resultant, Parametric...>;
+    return Specific(delegate);
+}
+#endif
+
+/**
+ * @brief
+ *     Constant dispatch table of delegates.
+ * @details
+ *     This aggregate type is a contiguous array of ThinlyProcedural 
+ *     delegates indexed by an enumeration or integer type.  Since delegates
+ *     to objects with static storage and to functions specified as template
+ *     arguments are constant expressions, a constexpr Tabular object is 
+ *     constant initialized and may be placed in read only storage, so it 
+ *     requires no static initializer.  Instances are created using the 
+ *     ProcureTabularly template, or by aggregate initialization.
+ * @tparam Indicative
+ *     Enumeration or integer index type.
+ * @tparam Length
+ *     Number of delegates.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Indicative, Cardinal Length, class Resultant, class... Parametric>
+struct Tabular {
+
+    /**
+     * @brief
+     *     Delegate type template instance alias.
+     */
+    using SameProcedural = ThinlyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Subscript operator.
+     * @param[in] index
+     *     Index of the delegate, which must be less than Length.
+     * @return
+     *     The delegate at index.
+     */
+    constexpr const SameProcedural& operator[](Indicative index) const
+    {
+        return procedures[static_cast<Cardinal>(index)];
+    }
+
+    /**
+     * @brief
+     *     Dispatch call operator.
+     * @details
+     *     Calls the delegate at index and returns its result to the calling
+     *     context.
+     * @param[in] index
+     *     Index of the delegate, which must be less than Length.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(Indicative index, Parametric... arguments) const
+    {
+        return procedures[static_cast<Cardinal>(index)](static_cast<Parametric&&>(arguments)...);
+    }
+
+    /**
+     * @brief
+     *     Number of delegates.
+     * @return
+     *     The Length template argument.
+     */
+    constexpr Cardinal length() const
+    {
+        return Length;
+    }
+
+    SameProcedural procedures[Length]; /**< Delegates in index order. */
+};
+
+/**
+ * @brief
+ *     Specify delegates as a constant dispatch table.
+ * @details
+ *     This function template is used to create a Tabular object from one or
+ *     more delegates of the same type, in index order, for example
+ *     constexpr auto table = ProcureTabularly<Command>(delegates...).
+ * @tparam Indicative
+ *     Enumeration or integer index type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @tparam ...Procedures
+ *     Types of the remaining delegates.
+ * @param[in] procedure
+ *     Delegate at index zero.
+ * @param[in] ...procedures
+ *     Delegates at the following indices.
+ * @return
+ *     Dispatch table of every delegate.
+ */
+template <class Indicative = Cardinal, class Resultant, class... Parametric, class... Procedures>
+static constexpr Tabular<Indicative, 1 + sizeof...(Procedures), Resultant, Parametric...>
+ProcureTabularly(
+    const ThinlyProcedural<Resultant, Parametric...>
+        procedure,
+    const Procedures...
+        procedures)
+{
+    return { { procedure, procedures... } };
+}
+
+/**
+ * @brief
+ *     Trivially copyable record of a call by procedure identifier.
+ * @details
+ *     This type is used to carry a call across a process boundary, such as
+ *     a queue in shared memory, where a procedure object can not be used 
+ *     because its virtual table pointer and object reference are local to
+ *     a process.  It holds the identifier of a procedure in a Registering
+ *     table and a copy of each argument inline, so it may be copied byte 
+ *     by byte, and a consumer dispatches it in place without copying it.
+ *     Define the macro PROCEDURE_MODULE_NOSTDCPP only if placement new is
+ *     declared before this header is included, which also prevents the
+ *     static assertion.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call, 
+ *     which must be trivially copyable values or constant references.
+ */
+template <class... Parametric>
+struct Recorded {
+
+    /**
+     * @brief
+     *     Stored argument type.
+     */
+    using Arguments = Bound<typename Unreferenced<Parametric>::Type...>;
+
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    static_assert(
+        ::std::is_trivially_copyable<Arguments>::value,
+        "Parametric: Trivially copyable parameter types required");
+#endif
+
+    /**
+     * @brief
+     *     Construct an empty record, for example in a ring of records.
+     */
+    Recorded() = default;
+
+    /**
+     * @brief
+     *     Construct a record of a call.
+     * @param[in] identifier
+     *     Identifier of the procedure in the consuming Registering table.
+     * @param[in] ...arguments
+     *     Arguments of the call, which are copied.
+     */
+    Recorded(Cardinal identifier, const typename Unreferenced<Parametric>::Type&... arguments)
+        : identifier(identifier)
+    {
+        new (storage) Arguments(typename Arguments::BaseBinding::Sequencial(), arguments...);
+    }
+
+    /**
+     * @brief
+     *     Recorded arguments.
+     * @return
+     *     Reference to the arguments, which must have been recorded.
+     */
+    const Arguments& arguments() const
+    {
+        return *reinterpret_cast<const Arguments*>(storage);
+    }
+
+    Cardinal identifier; /**< Identifier of the procedure. */
+
+    alignas(Arguments) unsigned char storage[sizeof(Arguments)]; /**< Arguments of the call. */
+};
+
+/**
+ * @brief
+ *     Registry of procedures by compact integer identifier.
+ * @details
+ *     This type is used to resolve the identifiers of Recorded calls to 
+ *     procedure references in constant time, by indexing an array.  Every 
+ *     process registers its own procedures, either with an explicit 
+ *     identifier using assign, or in turn using enroll, so that processes
+ *     which enroll the same procedures in the same order agree on their 
+ *     identifiers.  The procedures must outlive the registry.  It is not 
+ *     thread safe, so it is usually populated before consumers start.
+ * @tparam Capacity
+ *     Maximum number of procedures, which bounds the identifiers.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <Cardinal Capacity, class Resultant, class... Parametric>
+class Registering {
+
+public:
+    /**
+     * @brief
+     *     Procedural class type template instance alias.
+     */
+    using BaseProcedural = Procedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Record class type template instance alias.
+     */
+    using SameRecorded = Recorded<Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an empty registry.
+     */
+    constexpr Registering()
+        : procedures()
+        , count(0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Register a procedure with the next unused identifier.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @return
+     *     The identifier, or Capacity only if the registry is full.
+     */
+    Cardinal enroll(const BaseProcedural& procedure)
+    {
+        while (count < Capacity && procedures[count])
+            count++;
+        if (count >= Capacity)
+            return Capacity;
+        procedures[count] = &procedure;
+        return count++;
+    }
+
+    /**
+     * @brief
+     *     Register a procedure with an explicit identifier.
+     * @param[in] identifier
+     *     Identifier which the procedure will be resolved by.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @return
+     *     False only if the identifier is not less than Capacity or is 
+     *     already registered.
+     */
+    bool assign(Cardinal identifier, const BaseProcedural& procedure)
+    {
+        if (identifier >= Capacity || procedures[identifier])
+            return false;
+        procedures[identifier] = &procedure;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Unregister the procedure with an identifier.
+     * @param[in] identifier
+     *     Identifier of the procedure.
+     * @return
+     *     False only if the identifier was not registered.
+     */
+    bool remove(Cardinal identifier)
+    {
+        if (!contains(identifier))
+            return false;
+        procedures[identifier] = 0;
+        if (identifier < count)
+            count = identifier;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Determine whether an identifier is registered.
+     * @param[in] identifier
+     *     Identifier of the procedure.
+     * @return
+     *     True only if a procedure is registered with the identifier.
+     */
+    bool contains(Cardinal identifier) const
+    {
+        return identifier < Capacity && procedures[identifier];
+    }
+
+    /**
+     * @brief
+     *     Determine whether the identifier of a record is registered.
+     * @param[in] record
+     *     Record of a call.
+     * @return
+     *     True only if the record may be dispatched.
+     */
+    bool contains(const SameRecorded& record) const
+    {
+        return contains(record.identifier);
+    }
+
+    /**
+     * @brief
+     *     Resolve an identifier.
+     * @param[in] identifier
+     *     Identifier of the procedure.
+     * @return
+     *     Pointer to the registered procedure, or null if there is none.
+     */
+    const BaseProcedural* operator[](Cardinal identifier) const
+    {
+        return identifier < Capacity ? procedures[identifier] : 0;
+    }
+
+    /**
+     * @brief
+     *     Dispatch call operator.
+     * @details
+     *     Calls the procedure registered with the identifier of the record
+     *     with its recorded arguments, which are passed by constant 
+     *     reference to parameters of constant reference type, so the 
+     *     record is not copied.  The identifier is thrown if it is not 
+     *     registered, so define the macro PROCEDURE_MODULE_NOTHROW only if
+     *     every record is checked using contains.
+     * @param[in] record
+     *     Record of a call to a registered identifier.
+     * @return
+     *     The return result of the call.
+     */
+    Resultant operator()(const SameRecorded& record) const
+    {
+#ifndef PROCEDURE_MODULE_NOTHROW
+        if (!contains(record.identifier))
+            throw record.identifier;
+#endif
+        return record.arguments().template call<Resultant>(*procedures[record.identifier]);
+    }
+
+private:
+    const BaseProcedural* procedures[Capacity]; /**< Procedures by identifier. */
+
+    Cardinal count; /**< Identifiers below are registered. */
+};
+
+/**
+ * @brief
+ *     Hierarchical timer wheel of delegates.
+ * @details
+ *     This type is used to call delegates once a number of ticks have 
+ *     elapsed, with every timer stored inline in a fixed pool of Capacity
+ *     entries, so no allocation is made per timer.  Each of Levels wheels
+ *     has 2 to the power Bits slots, where a slot of the first wheel is 
+ *     one tick and a slot of each following wheel spans every slot of the
+ *     previous one, whose timers are cascaded to lower wheels as it is 
+ *     reached.  Slots are circular lists of entry indices, so arm and 
+ *     cancel take constant time, and advance calls every timer of a tick 
+ *     as one batch.  Timers beyond the range of every wheel are cascaded
+ *     again until their deadline is in range.  Timers are cancelled by the
+ *     handle returned when they are armed, which is not valid once the 
+ *     timer has been called or cancelled.  It is not thread safe and an
+ *     instance is usually in static storage, or allocated once, due to its
+ *     size.
+ * @tparam Capacity
+ *     Maximum number of pending timers.
+ * @tparam Bits
+ *     Base two logarithm of the number of slots of each wheel.
+ * @tparam Levels
+ *     Number of wheels.
+ */
+template <Cardinal Capacity, Cardinal Bits = 8, Cardinal Levels = 4>
+class Scheduling {
+
+    static_assert(
+        Capacity > 0 && Capacity < (1ULL << 32),
+        "Capacity: From one to less than two to the power 32 required");
+
+    static_assert(
+        Bits > 0 && Levels > 0 && Bits * Levels < 64,
+        "Bits, Levels: Range of less than two to the power 64 ticks required");
+
+public:
+    /**
+     * @brief
+     *     Delegate type which is called.
+     */
+    using SameProcedural = ThinlyProcedural<void>;
+
+    /**
+     * @brief
+     *     Number of slots of each wheel.
+     */
+    static constexpr Cardinal Slots = Cardinal(1) << Bits;
+
+    /**
+     * @brief
+     *     Construct an empty wheel at tick zero.
+     */
+    Scheduling()
+        : now(0)
+        , count(0)
+        , available(0)
+    {
+        for (Cardinal index = 0; index < Capacity; index++) {
+            entries[index].generation = 0;
+            links[index].next = index + 1;
+        }
+        for (Cardinal index = Capacity; index < Capacity + Sentinels; index++)
+            links[index].previous = links[index].next = index;
+    }
+
+    Scheduling(const Scheduling&) = delete;
+
+    Scheduling& operator=(const Scheduling&) = delete;
+
+    /**
+     * @brief
+     *     Arm a timer.
+     * @param[in] delay
+     *     Number of ticks until the call, where zero is the next tick.
+     * @param[in] procedure
+     *     Delegate which is copied and called once the delay has elapsed.
+     * @return
+     *     Non zero handle of the timer, or zero only if the wheel is full.
+     */
+    unsigned long long arm(unsigned long long delay, const SameProcedural& procedure)
+    {
+        if (available >= Capacity)
+            return 0;
+        const Cardinal index = available;
+        available = links[index].next;
+        Entry& entry = entries[index];
+        entry.procedure = procedure;
+        entry.deadline = now + (delay ? delay : 1);
+        entry.generation++;
+        count++;
+        Insert(index);
+        return Handle(index);
+    }
+
+    /**
+     * @brief
+     *     Cancel a timer.
+     * @param[in] handle
+     *     Handle returned when the timer was armed.
+     * @return
+     *     False only if the timer has been called or cancelled.
+     */
+    bool cancel(unsigned long long handle)
+    {
+        const unsigned long long index = (handle & 0xFFFFFFFFULL) - 1;
+        if (index >= Capacity || entries[index].generation != (handle >> 32) || !(entries[index].generation & 1))
+            return false;
+        Unlink(index);
+        Release(index);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Determine whether a timer is pending.
+     * @param[in] handle
+     *     Handle returned when the timer was armed.
+     * @return
+     *     True only if the timer has been neither called nor cancelled.
+     */
+    bool pending(unsigned long long handle) const
+    {
+        const unsigned long long index = (handle & 0xFFFFFFFFULL) - 1;
+        return index < Capacity && entries[index].generation == (handle >> 32) && (entries[index].generation & 1);
+    }
+
+    /**
+     * @brief
+     *     Advance time, calling every timer which expires.
+     * @details
+     *     Each tick cascades any slots which are reached, then calls every
+     *     timer of the tick, which may arm or cancel timers.  Timers armed
+     *     by a call expire no earlier than the next tick.
+     * @param[in] ticks
+     *     Number of ticks to advance.
+     * @return
+     *     Number of timers which were called.
+     */
+    Cardinal advance(unsigned long long ticks = 1)
+    {
+        Cardinal called = 0;
+        while (ticks--) {
+            now++;
+            for (Cardinal level = 1; level < Levels && !(now & Mask(level)); level++)
+                Cascade(level, Digit(now, level));
+            const Cardinal batch = Capacity + Sentinels - 1;
+            Splice(Slot(0, Digit(now, 0)), batch);
+            while (links[batch].next != batch) {
+                const Cardinal index = links[batch].next;
+                const SameProcedural procedure = entries[index].procedure;
+                Unlink(index);
+                Release(index);
+                procedure();
+                called++;
+            }
+        }
+        return called;
+    }
+
+    /**
+     * @brief
+     *     Current tick.
+     * @return
+     *     Number of ticks advanced since construction.
+     */
+    unsigned long long time() const
+    {
+        return now;
+    }
+
+    /**
+     * @brief
+     *     Number of pending timers.
+     * @return
+     *     The number of timers which have been neither called nor cancelled.
+     */
+    Cardinal length() const
+    {
+        return count;
+    }
+
+private:
+    // One sentinel per slot, followed by one for cascading and one for a batch
+    static constexpr Cardinal Sentinels = Levels * Slots + 2;
+
+    struct Entry {
+        SameProcedural procedure;
+        unsigned long long deadline;
+        unsigned generation;
+    };
+
+    struct Link {
+        Cardinal previous;
+        Cardinal next;
+    };
+
+    static constexpr unsigned long long Mask(Cardinal level)
+    {
+        return (1ULL << (Bits * level)) - 1;
+    }
+
+    static constexpr Cardinal Digit(unsigned long long tick, Cardinal level)
+    {
+        return static_cast<Cardinal>(tick >> (Bits * level)) & (Slots - 1);
+    }
+
+    static constexpr Cardinal Slot(Cardinal level, Cardinal digit)
+    {
+        return Capacity + level * Slots + digit;
+    }
+
+    unsigned long long Handle(Cardinal index) const
+    {
+        return static_cast<unsigned long long>(entries[index].generation) << 32 | (index + 1);
+    }
+
+    void Insert(Cardinal index)
+    {
+        // Deadlines beyond every wheel are placed at its furthest slot and cascaded again
+        const unsigned long long deadline = entries[index].deadline;
+        const unsigned long long range = Mask(Levels);
+        const unsigned long long position = deadline - now > range ? now + range : deadline;
+        Cardinal level = 0;
+        while (level + 1 < Levels && position - now > Mask(level + 1))
+            level++;
+        const Cardinal slot = Slot(level, Digit(position, level));
+        links[index].previous = links[slot].previous;
+        links[index].next = slot;
+        links[links[slot].previous].next = index;
+        links[slot].previous = index;
+    }
+
+    void Unlink(Cardinal index)
+    {
+        links[links[index].previous].next = links[index].next;
+        links[links[index].next].previous = links[index].previous;
+    }
+
+    void Release(Cardinal index)
+    {
+        entries[index].generation++;
+        links[index].next = available;
+        available = index;
+        count--;
+    }
+
+    void Splice(Cardinal slot, Cardinal sentinel)
+    {
+        if (links[slot].next == slot) {
+            links[sentinel].previous = links[sentinel].next = sentinel;
+            return;
+        }
+        links[sentinel].next = links[slot].next;
+        links[sentinel].previous = links[slot].previous;
+        links[links[slot].next].previous = sentinel;
+        links[links[slot].previous].next = sentinel;
+        links[slot].previous = links[slot].next = slot;
+    }
+
+    void Cascade(Cardinal level, Cardinal digit)
+    {
+        const Cardinal cascading = Capacity + Sentinels - 2;
+        Splice(Slot(level, digit), cascading);
+        while (links[cascading].next != cascading) {
+            const Cardinal index = links[cascading].next;
+            Unlink(index);
+            Insert(index);
+        }
+    }
+
+    Entry entries[Capacity]; /**< Timers by index. */
+
+    Link links[Capacity + Sentinels]; /**< Slot lists of timers and the free list. */
+
+    unsigned long long now; /**< Current tick. */
+
+    Cardinal count; /**< Number of pending timers. */
+
+    Cardinal available; /**< First free entry, or Capacity. */
+};
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+class Tracking;
+
+/**
+ * @brief
+ *     Trackable target base class.
+ * @details
+ *     This type is used as a base class of an object which trackable
+ *     procedures call, so that they are not called once the object has
+ *     been destroyed.  Each trackable procedure links itself into an
+ *     intrusive list which this type heads, and the destructor detaches
+ *     every procedure in the list, so no reference count is kept.  A copy
+ *     of an object is not tracked by the procedures of the original.  An
+ *     object and the procedures which track it must only be used by one
+ *     thread at a time.
+ */
+class Trackable {
+
+public:
+    /**
+     * @brief
+     *     Construct an untracked object.
+     */
+    constexpr Trackable()
+        : first(0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct an untracked copy of an object.
+     */
+    constexpr Trackable(const Trackable&)
+        : first(0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Assignment does not change which procedures track either object.
+     * @return
+     *     Reference to this object.
+     */
+    Trackable& operator=(const Trackable&)
+    {
+        return *this;
+    }
+
+    /**
+     * @brief
+     *     Detach every procedure which tracks this object.
+     */
+    inline ~Trackable();
+
+private:
+    friend class Tracking;
+
+    mutable const Tracking* first; /**< First procedure which tracks this object. */
+};
+
+/**
+ * @brief
+ *     Trackable procedure link base class.
+ * @details
+ *     This type is used by trackable procedures to reference the Trackable
+ *     target and to link into it's list of tracking procedures.  Checking
+ *     whether the target is alive is one load, of the target address which
+ *     the Trackable destructor clears.
+ */
+class Tracking {
+
+public:
+    /**
+     * @brief
+     *     Determine whether the tracked object is alive.
+     * @return
+     *     False only if the tracked object has been destroyed.
+     */
+    bool live() const
+    {
+        return target != 0;
+    }
+
+protected:
+    /**
+     * @brief
+     *     Construct a link which tracks an object.
+     * @param[in] target
+     *     The object which is tracked.
+     */
+    Tracking(const Trackable& target)
+        : target(&target)
+        , previous(0)
+        , next(target.first)
+    {
+        if (next)
+            next->previous = this;
+        target.first = this;
+    }
+
+    /**
+     * @brief
+     *     Construct a link which tracks the same object as another.
+     * @details
+     *     If the object of copy has been destroyed, neither is tracked.
+     * @param[in] copy
+     *     The link to copy.
+     */
+    Tracking(const Tracking& copy)
+        : target(copy.target)
+        , previous(&copy)
+        , next(copy.next)
+    {
+        if (!target) {
+            previous = 0;
+            return;
+        }
+        if (next)
+            next->previous = this;
+        copy.next = this;
+    }
+
+    Tracking& operator=(const Tracking&) = delete;
+
+    /**
+     * @brief
+     *     Unlink from the tracked object if it is alive.
+     */
+    ~Tracking()
+    {
+        if (!target)
+            return;
+        if (previous)
+            previous->next = next;
+        else
+            target->first = next;
+        if (next)
+            next->previous = previous;
+    }
+
+private:
+    friend class Trackable;
+
+    mutable const Trackable* target; /**< Tracked object, or null once destroyed. */
+
+    mutable const Tracking* previous; /**< Previous link of the same object. */
+
+    mutable const Tracking* next; /**< Next link of the same object. */
+};
+
+inline Trackable::~Trackable()
+{
+    for (const Tracking* link = first; link;) {
+        const Tracking* const next = link->next;
+        link->target = 0;
+        link->previous = link->next = 0;
+        link = next;
+    }
+}
+
+/**
+ * @brief
+ *     Abstract trackable procedural base class.
+ * @details
+ *     This type is used to call, compare or track procedures matching the 
+ *     specified return and parameter types, which are not called once 
+ *     their Trackable object has been destroyed.  The Multicasting add
+ *     function accepts this type to prune such procedures lazily.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+class TrackablyProcedural : public ComparablyProcedural<Resultant, Parametric...>,
+                            public Tracking {
+
+protected:
+    /**
+     * @brief
+     *     Construct tracking an object.
+     * @param[in] target
+     *     The object which is tracked.
+     */
+    TrackablyProcedural(const Trackable& target)
+        : Tracking(target)
+    {
+    }
+
+    /**
+     * @brief
+     *     Construct tracking the same object as another.
+     * @param[in] copy
+     *     The link to copy.
+     */
+    TrackablyProcedural(const Tracking& copy)
+        : Tracking(copy)
+    {
+    }
+};
+
+/**
+ * @brief         
+ *     Class for calling any trackable callable object.
+ * @details       
+ *     This type is used to call, compare or track a callable object which
+ *     is derived from Trackable.  A call after the object has been 
+ *     destroyed does nothing and returns a value initialized result, so 
+ *     Resultant must be void or default constructible.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class Resultant, class... Parametric>
+class TrackablyObjective : public TrackablyProcedural<Resultant, Parametric...>,
+                           public Objective<Typical, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameObjective = TrackablyObjective<Typical, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseObjective = Objective<Typical, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a trackable callable object reference.
+     * @param[in] object
+     *     The procedural call object which will be called by reference.
+     */
+    TrackablyObjective(Typical& object)
+        : TrackablyProcedural<Resultant, Parametric...>(object)
+        , BaseObjective(object)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Construct a copy of a trackable callable object reference.
+     * @details       
+     *     The resulting instance will track and reference the same object.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    TrackablyObjective(const SameObjective& copy)
+        : TrackablyProcedural<Resultant, Parametric...>(copy)
+        , BaseObjective(copy)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object call operator.
+     * @details       
+     *     Calls the object by reference only if it is alive.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call, or a value initialized result.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        if (!this->live())
+            return Resultant();
+        return this->object(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural equal to operator.
+     * @details       
+     *     Compares object addresses as ComparablyObjective does, which 
+     *     does not access the object, so it is valid once destroyed.
+     * @param[in] relative
+     *     Relative procedural instance to compare equality with.
+     * @return
+     *     True only if relative is of this class and references the same
+     *     object.
+     */
+    bool operator==(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return false;
+        return BaseObjective::operator==(static_cast<const SameObjective&>(relative));
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameObjective>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseObjective::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        return BaseObjective::operator<(static_cast<const SameObjective&>(relative));
+    }
+};
+
+/**
+ * @brief         
+ *     Class for calling any member function of a trackable object.
+ * @details       
+ *     This type is used to call, compare or track a member function of an
+ *     object which is derived from Trackable.  A call after the object has
+ *     been destroyed does nothing and returns a value initialized result,
+ *     so Resultant must be void or default constructible.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class MethodLocational, class Resultant, class... Parametric>
+class TrackablyMethodic : public TrackablyProcedural<Resultant, Parametric...>,
+                          public Methodic<Typical, MethodLocational, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Same class type template instance alias.
+     */
+    using SameMethodic = TrackablyMethodic<Typical, MethodLocational, Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseMethodic = Methodic<Typical, MethodLocational, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a trackable member function reference.
+     * @param[in] object
+     *     The object which the member function will be called on.
+     * @param[in] method
+     *     The member function which will be called.
+     */
+    TrackablyMethodic(Typical& object, const MethodLocational method)
+        : TrackablyProcedural<Resultant, Parametric...>(object)
+        , BaseMethodic(object, method)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Construct a copy of a trackable member function reference.
+     * @details       
+     *     The resulting instance will track and reference the same object.
+     * @param[in] copy
+     *     The instance of this class to copy.
+     */
+    TrackablyMethodic(const SameMethodic& copy)
+        : TrackablyProcedural<Resultant, Parametric...>(copy)
+        , BaseMethodic(copy)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural member function call operator.
+     * @details       
+     *     Calls the member function only if the object is alive.
+     * @param[in] ...arguments
+     *     Argument pack which is expanded and forwarded.
+     * @return
+     *     The return result of the call, or a value initialized result.
+     */
+    Resultant operator()(Parametric... arguments) const final
+    {
+        if (!this->live())
+            return Resultant();
+        return (this->object.*this->method)(static_cast<Parametric&&>(arguments)...);
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural equal to operator.
+     * @details       
+     *     Compares object and member function addresses as 
+     *     ComparablyMethodic does, which does not access the object.
+     * @param[in] relative
+     *     Relative procedural instance to compare equality with.
+     * @return
+     *     True only if relative is of this class and references the same
+     *     object and member function.
+     */
+    bool operator==(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return false;
+        return BaseMethodic::operator==(static_cast<const SameMethodic&>(relative));
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural identity function.
+     * @return
+     *     Address of the identity tag of this class.
+     */
+    const void* identify() const final
+    {
+        return &Identical<SameMethodic>::tag;
+    }
+
+    /**
+     * @brief
+     *     ComparablyProcedural hash function.
+     * @return
+     *     Hash value of this procedure.
+     */
+    Cardinal hash() const final
+    {
+        const void* const identity = this->identify();
+        return BaseMethodic::hash(Digest(&identity, sizeof(identity)));
+    }
+
+    /** 
+     * @brief         
+     *     ComparablyProcedural less than operator.
+     * @param[in] relative
+     *     Relative procedural instance to be compared less than.
+     * @return
+     *     True only if this is ordered before relative.
+     */
+    bool operator<(const SameProcedural& relative) const final
+    {
+        if (relative.identify() != this->identify())
+            return this->precedes(relative);
+        return BaseMethodic::operator<(static_cast<const SameMethodic&>(relative));
+    }
+};
+
+/**
+ * @brief         
+ *     Specify a trackable callable object as a procedural call object.
+ * @details       
+ *     This function template is used to create a trackable representation
+ *     of a procedural call to a callable object derived from Trackable.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the callable object which will be called.
+ * @param[in] guide
+ *     Function pointer whose type guides the procedure type.
+ * @return
+ *     Procedural object which tracks and references object.
+ */
+template <class Typical, class Resultant, class... Parametric>
+static TrackablyObjective<Typical, Resultant, Parametric...>
+ProcureTrackably(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = TrackablyObjective<Typical, Resultant, Parametric...>;
+    return Specific(object);
+}
+
+/**
+ * @brief         
+ *     Specify a member function of a trackable object as a procedural call 
+ *     object.
+ * @details       
+ *     This function template is used to create a trackable representation
+ *     of a procedural call to a member function of an object derived from
+ *     Trackable.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ * @param[in] object
+ *     Reference to the object which the member function will be called on.
+ * @param[in] method
+ *     Pointer to the member function which will be called.
+ * @param[in] guide
+ *     Function pointer whose type guides the procedure type.
+ * @return
+ *     Procedural object which tracks and references object and method.
+ */
+template <class Typical, class MethodLocational, class Resultant, class... Parametric>
+static TrackablyMethodic<Typical, MethodLocational, Resultant, Parametric...>
+ProcureTrackably(
+    Typical&
+        object,
+    const MethodLocational
+        method,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+    using namespace std;
+    static_assert(
+        is_member_function_pointer<MethodLocational>::value,
+        "MethodLocational: Pointer to member function type required");
+#endif
+    using Specific = TrackablyMethodic<Typical, MethodLocational, Resultant, Parametric...>;
+    return Specific(object, method);
+}
+
+/**
+ * @brief
+ *     Multicast procedure list with fixed inline storage.
+ * @details
+ *     This type is used to call every procedure which has been added to it,
+ *     in the order they were added, with the same arguments.  Procedures 
+ *     are referenced by address in a contiguous array of fixed capacity, so
+ *     they must outlive their membership and no heap allocation is made.
+ *     Trackable procedures are removed lazily, by the first call after the
+ *     object which they track has been destroyed.
+ *     Procedures are removed using the ComparablyProcedural equal to 
+ *     operator.  A procedure may add or remove procedures while it is being
+ *     called, where added procedures are first called by the next call and 
+ *     removed procedures which have not yet been called are skipped.  
+ *     Return values are discarded and arguments are passed to each 
+ *     procedure as lvalues, so rvalue reference parameters are not 
+ *     supported.
+ * @tparam Capacity
+ *     Maximum number of procedures.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <Cardinal Capacity, class Resultant, class... Parametric>
+class Multicasting {
+
+public:
+    /**
+     * @brief
+     *     Comparable procedural class type template instance alias.
+     */
+    using SameProcedural = ComparablyProcedural<Resultant, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an empty list.
+     */
+    constexpr Multicasting()
+        : procedures()
+        , trackers()
+        , count(0)
+        , depth(0)
+        , vacancies(0)
+    {
+    }
+
+    /**
+     * @brief
+     *     Add a procedure to the end of the list.
+     * @details
+     *     The same procedure may be added more than once.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @return
+     *     False only if the list is full.
+     */
+    bool add(const SameProcedural& procedure)
+    {
+        if (count >= Capacity)
+            return false;
+        trackers[count] = 0;
+        procedures[count++] = &procedure;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Add a trackable procedure to the end of the list.
+     * @details
+     *     Once the object which the procedure tracks has been destroyed, 
+     *     the procedure is no longer called and it's entry is removed by 
+     *     the next call of the list.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @return
+     *     False only if the list is full.
+     */
+    bool add(const TrackablyProcedural<Resultant, Parametric...>& procedure)
+    {
+        if (!add(static_cast<const SameProcedural&>(procedure)))
+            return false;
+        trackers[count - 1] = &procedure;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Remove the first procedure which is equal to the one specified.
+     * @details
+     *     If the list is being called, the entry is vacated and the list is
+     *     compacted once the outermost call returns.
+     * @param[in] procedure
+     *     Procedure to be compared equal to.
+     * @return
+     *     True only if an equal procedure was removed.
+     */
+    bool remove(const SameProcedural& procedure)
+    {
+        for (Cardinal index = 0; index < count; index++) {
+            if (!procedures[index] || !(*procedures[index] == procedure))
+                continue;
+            if (depth) {
+                procedures[index] = 0;
+                vacancies++;
+            } else {
+                for (Cardinal next = index + 1; next < count; next++) {
+                    procedures[next - 1] = procedures[next];
+                    trackers[next - 1] = trackers[next];
+                }
+                count--;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Determine whether an equal procedure is in the list.
+     * @param[in] procedure
+     *     Procedure to be compared equal to.
+     * @return
+     *     True only if an equal procedure is found.
+     */
+    bool contains(const SameProcedural& procedure) const
+    {
+        for (Cardinal index = 0; index < count; index++)
+            if (procedures[index] && *procedures[index] == procedure)
+                return true;
+        return false;
+    }
+
+    /**
+     * @brief
+     *     Remove every procedure.
+     * @details
+     *     If the list is being called, the remaining procedures are skipped.
+     */
+    void clear()
+    {
+        if (depth) {
+            for (Cardinal index = 0; index < count; index++)
+                if (procedures[index]) {
+                    procedures[index] = 0;
+                    vacancies++;
+                }
+        } else {
+            count = 0;
+        }
+    }
+
+    /**
+     * @brief
+     *     Number of procedures in the list.
+     * @return
+     *     Count of procedures which have not been removed, including 
+     *     trackable procedures whose object was destroyed since the last
+     *     call.
+     */
+    constexpr Cardinal length() const
+    {
+        return count - vacancies;
+    }
+
+    /**
+     * @brief
+     *     Call each procedure in the list.
+     * @details
+     *     Trackable procedures whose object has been destroyed are removed
+     *     instead of being called, at the cost of one load each.
+     * @param[in] ...arguments
+     *     Argument pack which is passed to each procedure.
+     */
+    void operator()(Parametric... arguments)
+    {
+        const Cardinal called = count;
+        const Calling calling(*this);
+        for (Cardinal index = 0; index < called; index++) {
+            const SameProcedural* const procedure = procedures[index];
+            if (!procedure)
+                continue;
+            if (trackers[index] && !trackers[index]->live()) {
+                procedures[index] = 0;
+                vacancies++;
+                continue;
+            }
+            (*procedure)(arguments...);
+        }
+    }
+
+private:
+    // Compacts vacated entries once the outermost call returns or throws
+    class Calling {
+    public:
+        Calling(Multicasting& list)
+            : list(list)
+        {
+            list.depth++;
+        }
+
+        ~Calling()
+        {
+            if (--list.depth == 0 && list.vacancies)
+                list.compact();
+        }
+
+    private:
+        Multicasting& list;
+    };
+
+    void compact()
+    {
+        Cardinal kept = 0;
+        for (Cardinal index = 0; index < count; index++)
+            if (procedures[index]) {
+                trackers[kept] = trackers[index];
+                procedures[kept++] = procedures[index];
+            }
+        count = kept;
+        vacancies = 0;
+    }
+
+    const SameProcedural* procedures[Capacity]; /**< Procedure addresses. */
+
+    const Tracking* trackers[Capacity]; /**< Trackable procedure links, or null. */
+
+    Cardinal count; /**< Number of used entries, including vacancies. */
+
+    Cardinal depth; /**< Number of calls in progress. */
+
+    Cardinal vacancies; /**< Number of entries removed during calls. */
+};
+#endif
+
+/**
+ * @brief
+ *     Monotonic procedure arena with fixed inline storage.
+ * @details
+ *     This type retains copies of procedure objects beyond the scope they
+ *     were created in, such as those returned by Procure, ProcureComparably
+ *     or ProcureRepeatedly, by constructing them consecutively in its 
+ *     inline storage.  Since procedure objects only reference their 
+ *     callable objects they are trivially destructible, so every retained
+ *     procedure is released at once in constant time and no heap 
+ *     allocation is ever made.
+ * @tparam Capacity
+ *     Size in bytes of the inline storage.
+ */
+template <Cardinal Capacity>
+class Monotonic {
+
+public:
+    /**
+     * @brief
+     *     Construct an empty arena.
+     */
+    constexpr Monotonic()
+        : storage()
+        , used(0)
+    {
+    }
+
+    Monotonic(const Monotonic&) = delete;
+
+    Monotonic& operator=(const Monotonic&) = delete;
+
+    /**
+     * @brief
+     *     Retain a copy of a procedure object.
+     * @details
+     *     Define the macro PROCEDURE_MODULE_NOSTDCPP to prevent the static
+     *     assertion if the type_traits standard library header is not
+     *     available.
+     * @tparam Specific
+     *     Type of the procedure object, which must be trivially 
+     *     destructible.
+     * @param[in] procedure
+     *     The procedure object which will be copied.
+     * @return
+     *     Address of the retained copy, or null if the arena is full.
+     */
+    template <class Specific>
+    const Specific* retain(const Specific& procedure)
+    {
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+        static_assert(
+            ::std::is_trivially_destructible<Specific>::value,
+            "Specific: Trivially destructible procedure object required");
+#endif
+        static_assert(
+            alignof(Specific) <= alignof(long double),
+            "Specific: Procedure object alignment exceeds the inline storage");
+        const Cardinal first = (used + alignof(Specific) - 1) & ~(alignof(Specific) - 1);
+        if (first > Capacity || Capacity - first < sizeof(Specific))
+            return 0;
+        used = first + sizeof(Specific);
+        return new (storage + first) Specific(procedure);
+    }
+
+    /**
+     * @brief
+     *     Release every retained procedure in constant time.
+     */
+    void clear()
+    {
+        used = 0;
+    }
+
+    /**
+     * @brief
+     *     Number of bytes of storage in use.
+     * @return
+     *     The number of bytes, including alignment padding.
+     */
+    constexpr Cardinal length() const
+    {
+        return used;
+    }
+
+private:
+    alignas(long double) unsigned char storage[Capacity]; /**< Inline storage. */
+
+    Cardinal used; /**< Number of bytes in use. */
+};
+
+/**
+ * @brief
+ *     Pooled procedure arena with fixed inline storage.
+ * @details
+ *     This type retains copies of procedure objects in fixed size slots,
+ *     so unlike Monotonic each procedure may also be released on its own
+ *     and its slot reused.  Released slots are kept on a free list and 
+ *     unused slots are handed out in order, so retaining, releasing and 
+ *     releasing every procedure at once are all constant time and no heap
+ *     allocation is ever made.
+ * @tparam Size
+ *     Size in bytes of each slot, which limits the procedure object size.
+ * @tparam Count
+ *     Number of slots.
+ */
+template <Cardinal Size, Cardinal Count>
+class Pooling {
+
+public:
+    /**
+     * @brief
+     *     Construct an empty pool.
+     */
+    constexpr Pooling()
+        : slots()
+        , vacant(0)
+        , used(0)
+    {
+    }
+
+    Pooling(const Pooling&) = delete;
+
+    Pooling& operator=(const Pooling&) = delete;
+
+    /**
+     * @brief
+     *     Retain a copy of a procedure object.
+     * @details
+     *     Define the macro PROCEDURE_MODULE_NOSTDCPP to prevent the static
+     *     assertion if the type_traits standard library header is not
+     *     available.
+     * @tparam Specific
+     *     Type of the procedure object, which must be trivially 
+     *     destructible.
+     * @param[in] procedure
+     *     The procedure object which will be copied.
+     * @return
+     *     Address of the retained copy, or null if every slot is in use.
+     */
+    template <class Specific>
+    const Specific* retain(const Specific& procedure)
+    {
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+        static_assert(
+            ::std::is_trivially_destructible<Specific>::value,
+            "Specific: Trivially destructible procedure object required");
+#endif
+        static_assert(
+            sizeof(Specific) <= Size,
+            "Size: Procedure object does not fit a slot");
+        static_assert(
+            alignof(Specific) <= alignof(long double),
+            "Specific: Procedure object alignment exceeds the slot storage");
+        Slot* slot = vacant;
+        if (slot)
+            vacant = slot->next;
+        else if (used < Count)
+            slot = &slots[used++];
+        else
+            return 0;
+        return new (slot->storage) Specific(procedure);
+    }
+
+    /**
+     * @brief
+     *     Release one retained procedure.
+     * @details
+     *     The address must have the type returned by retain, since a base
+     *     class subobject may not start at the slot.  Define the macro 
+     *     PROCEDURE_MODULE_NOSTDCPP to prevent the static assertion if the
+     *     type_traits standard library header is not available.
+     * @tparam Specific
+     *     Type of the procedure object, which must not be abstract.
+     * @param[in] procedure
+     *     Address of a procedure which was retained by this pool.
+     */
+    template <class Specific>
+    void release(const Specific* procedure)
+    {
+#ifndef PROCEDURE_MODULE_NOSTDCPP
+        static_assert(
+            !::std::is_abstract<Specific>::value,
+            "Specific: Type returned by retain required, not an abstract base");
+#endif
+        Slot* slot = reinterpret_cast<Slot*>(const_cast<Specific*>(procedure));
+        slot->next = vacant;
+        vacant = slot;
+    }
+
+    /**
+     * @brief
+     *     Release every retained procedure in constant time.
+     */
+    void clear()
+    {
+        vacant = 0;
+        used = 0;
+    }
+
+private:
+    union Slot {
+        alignas(long double) unsigned char storage[Size]; /**< Procedure storage. */
+        Slot* next; /**< Next free slot. */
+    };
+
+    Slot slots[Count]; /**< Slot storage. */
+
+    Slot* vacant; /**< Most recently released slot. */
+
+    Cardinal used; /**< Number of slots handed out in order. */
+};
+
+/**
+ * @brief
+ *     Fixed capacity buffer of deferred procedure calls.
+ * @details
+ *     This type is used to record calls now and make them later, for 
+ *     example at the end of a frame.  Each call is recorded as the address
+ *     of the procedure and a copy of it's arguments, constructed in place 
+ *     in a contiguous array of records, so no heap allocation is made and 
+ *     flush calls the records in one loop.  A call recorded by coalesce 
+ *     replaces the arguments of a pending call of an equal 
+ *     ComparablyProcedural, keeping it's place, so that redundant calls 
+ *     are made once with the latest arguments.  Procedures are referenced
+ *     by address, so they must outlive the flush.  Arguments are stored 
+ *     without references and are moved into the call, so rvalue reference
+ *     parameters are supported.
+ * @tparam Capacity
+ *     Maximum number of pending calls.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <Cardinal Capacity, class... Parametric>
+class Deferring {
+
+public:
+    /**
+     * @brief
+     *     Procedural class type template instance alias.
+     */
+    using BaseProcedural = Procedural<void, Parametric...>;
+
+    /**
+     * @brief
+     *     Construct an empty buffer.
+     */
+    constexpr Deferring()
+        : records()
+        , count(0)
+        , cursor(0)
+        , limit(0)
+    {
+    }
+
+    Deferring(const Deferring&) = delete;
+
+    Deferring& operator=(const Deferring&) = delete;
+
+    /**
+     * @brief
+     *     Discard every pending call.
+     */
+    ~Deferring()
+    {
+        clear();
+    }
+
+    /**
+     * @brief
+     *     Record a call to be made by the next flush.
+     * @tparam ...Propagational
+     *     Argument types, deduced as forwarding references.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @param[in] ...arguments
+     *     Arguments which are copied if they are lvalues, otherwise moved.
+     * @return
+     *     False only if the buffer is full.
+     */
+    template <class... Propagational>
+    bool defer(const BaseProcedural& procedure, Propagational&&... arguments)
+    {
+        if (count >= Capacity)
+            return false;
+        Record& record = records[count++];
+        record.procedure = &procedure;
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+        record.comparable = 0;
+#endif
+        new (record.arguments) Arguments(Sequencial(), static_cast<Propagational&&>(arguments)...);
+        return true;
+    }
+
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+    /**
+     * @brief
+     *     Record a call, coalesced with a pending call of an equal procedure.
+     * @details
+     *     Pending calls recorded by coalesce are found by their hash first,
+     *     then by the equal to operator.  A call which has already been 
+     *     made by a flush in progress is not coalesced with.
+     * @tparam ...Propagational
+     *     Argument types, deduced as forwarding references.
+     * @param[in] procedure
+     *     Procedure which will be called by reference.
+     * @param[in] ...arguments
+     *     Arguments which are copied if they are lvalues, otherwise moved.
+     * @return
+     *     False only if there is no equal pending call and the buffer is 
+     *     full.
+     */
+    template <class... Propagational>
+    bool coalesce(const ComparablyProcedural<void, Parametric...>& procedure, Propagational&&... arguments)
+    {
+        const Cardinal hash = procedure.hash();
+        for (Cardinal index = cursor; index < count; index++) {
+            Record& record = records[index];
+            if (!record.comparable || record.hash != hash || !(*record.comparable == procedure))
+                continue;
+            Arguments& pending = *reinterpret_cast<Arguments*>(record.arguments);
+            pending.~Arguments();
+            new (record.arguments) Arguments(Sequencial(), static_cast<Propagational&&>(arguments)...);
+            return true;
+        }
+        if (!defer(procedure, static_cast<Propagational&&>(arguments)...))
+            return false;
+        records[count - 1].comparable = &procedure;
+        records[count - 1].hash = hash;
+        return true;
+    }
+#endif
+
+    /**
+     * @brief
+     *     Make every pending call in the order they were recorded.
+     * @details
+     *     Calls recorded while flushing are made by the next flush.  A call
+     *     which is made must not flush the same buffer.  If a call throws 
+     *     an exception its arguments are still destroyed, and the calls 
+     *     which were not made remain pending.
+     */
+    void flush()
+    {
+        limit = count;
+        while (cursor < limit) {
+            Record& record = records[cursor++];
+            Arguments& arguments = *reinterpret_cast<Arguments*>(record.arguments);
+            Destroying destroying(arguments);
+            arguments.template consume<void>(*record.procedure);
+        }
+        Cardinal kept = 0;
+        for (Cardinal index = limit; index < count; index++, kept++) {
+            Record& record = records[index];
+            Arguments& arguments = *reinterpret_cast<Arguments*>(record.arguments);
+            records[kept].procedure = record.procedure;
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+            records[kept].comparable = record.comparable;
+            records[kept].hash = record.hash;
+#endif
+            new (records[kept].arguments) Arguments(static_cast<Arguments&&>(arguments));
+            arguments.~Arguments();
+        }
+        count = kept;
+        cursor = limit = 0;
+    }
+
+    /**
+     * @brief
+     *     Discard every pending call without making it.
+     * @details
+     *     During a flush, the calls which it has not yet made are discarded.
+     */
+    void clear()
+    {
+        for (Cardinal index = cursor; index < count; index++)
+            reinterpret_cast<Arguments*>(records[index].arguments)->~Arguments();
+        count = limit = cursor;
+    }
+
+    /**
+     * @brief
+     *     Number of pending calls.
+     * @return
+     *     Count of calls which have not been made.
+     */
+    constexpr Cardinal length() const
+    {
+        return count - cursor;
+    }
+
+private:
+    using Arguments = Bound<typename Unreferenced<Parametric>::Type...>;
+
+    using Sequencial = typename Arguments::BaseBinding::Sequencial;
+
+    class Destroying {
+    public:
+        Destroying(Arguments& arguments)
+            : arguments(arguments)
+        {
+        }
+
+        ~Destroying()
+        {
+            arguments.~Arguments();
+        }
+
+    private:
+        Arguments& arguments;
+    };
+
+    struct Record {
+        const BaseProcedural* procedure;
+#ifndef PROCEDURE_MODULE_NOVIRTUAL
+        const ComparablyProcedural<void, Parametric...>* comparable;
+        Cardinal hash;
+#endif
+        alignas(Arguments) unsigned char arguments[sizeof(Arguments)];
+    };
+
+    Record records[Capacity]; /**< Pending calls, with their arguments in place. */
+
+    Cardinal count; /**< Number of records in use, including those called. */
+
+    Cardinal cursor; /**< Index of the next record to call. */
+
+    Cardinal limit; /**< Index after the last record of the flush in progress. */
+};
+
+/**
+ * @brief
+ *     Fixed width vector of lanes.
+ * @details
+ *     This type is used as the parameter and return type of a procedure 
+ *     which is called once for Width elements, for example with a lambda
+ *     expression which is generic over float and Vectorial<float, 8>.  The
+ *     arithmetic operators are applied to each lane in a loop of constant
+ *     trip count over storage aligned to the vector, up to 32 bytes, which
+ *     optimizing compilers vectorize into SSE, AVX or NEON instructions 
+ *     without intrinsics.
+ * @tparam Typical
+ *     Type of each lane.
+ * @tparam Width
+ *     Number of lanes, a power of two.
+ */
+template <class Typical, Cardinal Width>
+struct alignas(alignof(Typical) * Width < 32 ? alignof(Typical) * Width : 32) Vectorial {
+
+    static_assert(
+        Width > 0 && (Width & (Width - 1)) == 0,
+        "Width: Power of two required");
+
+    /**
+     * @brief
+     *     Construct a vector of indeterminate lanes.
+     */
+    Vectorial() = default;
+
+    /**
+     * @brief
+     *     Construct a vector with every lane equal.
+     * @details
+     *     This conversion allows a scalar operand of an arithmetic operator,
+     *     so that a generic lambda expression may use literals.
+     * @param[in] value
+     *     Value of each lane.
+     */
+    Vectorial(const Typical value)
+    {
+        for (Cardinal lane = 0; lane < Width; lane++)
+            lanes[lane] = value;
+    }
+
+    /**
+     * @brief
+     *     Load lanes from consecutive elements.
+     * @param[in] location
+     *     Address of the first of Width elements.
+     * @return
+     *     Vector of the elements.
+     */
+    static Vectorial Load(const Typical* location)
+    {
+        Vectorial loaded;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            loaded.lanes[lane] = location[lane];
+        return loaded;
+    }
+
+    /**
+     * @brief
+     *     Store lanes to consecutive elements.
+     * @param[out] location
+     *     Address of the first of Width elements.
+     */
+    void store(Typical* location) const
+    {
+        for (Cardinal lane = 0; lane < Width; lane++)
+            location[lane] = lanes[lane];
+    }
+
+    /**
+     * @brief
+     *     Lanewise addition operator.
+     */
+    friend Vectorial operator+(const Vectorial& left, const Vectorial& right)
+    {
+        Vectorial result;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            result.lanes[lane] = left.lanes[lane] + right.lanes[lane];
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Lanewise subtraction operator.
+     */
+    friend Vectorial operator-(const Vectorial& left, const Vectorial& right)
+    {
+        Vectorial result;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            result.lanes[lane] = left.lanes[lane] - right.lanes[lane];
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Lanewise multiplication operator.
+     */
+    friend Vectorial operator*(const Vectorial& left, const Vectorial& right)
+    {
+        Vectorial result;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            result.lanes[lane] = left.lanes[lane] * right.lanes[lane];
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Lanewise division operator.
+     */
+    friend Vectorial operator/(const Vectorial& left, const Vectorial& right)
+    {
+        Vectorial result;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            result.lanes[lane] = left.lanes[lane] / right.lanes[lane];
+        return result;
+    }
+
+    /**
+     * @brief
+     *     Lanewise negation operator.
+     */
+    friend Vectorial operator-(const Vectorial& vector)
+    {
+        Vectorial result;
+        for (Cardinal lane = 0; lane < Width; lane++)
+            result.lanes[lane] = -vector.lanes[lane];
+        return result;
+    }
+
+    Vectorial& operator+=(const Vectorial& right) { return *this = *this + right; } /**< Lanewise addition. */
+
+    Vectorial& operator-=(const Vectorial& right) { return *this = *this - right; } /**< Lanewise subtraction. */
+
+    Vectorial& operator*=(const Vectorial& right) { return *this = *this * right; } /**< Lanewise multiplication. */
+
+    Vectorial& operator/=(const Vectorial& right) { return *this = *this / right; } /**< Lanewise division. */
+
+    Typical lanes[Width]; /**< Lane values. */
+};
+
+/**
+ * @brief
+ *     Class for calling a lane generic callable object over arrays.
+ * @details
+ *     This type is used to call a callable object which is generic over
+ *     the lane type, once for each Width elements of structure of arrays
+ *     arguments through one indirect call, then once for each remaining 
+ *     element.  The callable object is called with Vectorial arguments and
+ *     must return a Vectorial result, or with Parametric arguments and 
+ *     must return Resultant.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Width
+ *     Number of lanes of each call.
+ * @tparam Resultant
+ *     Result type of each element.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the element types of each argument
+ *     array.
+ */
+template <class Typical, Cardinal Width, class Resultant, class... Parametric>
+class LanewiseObjective : public Procedural<void, Cardinal, Resultant*, const Parametric*...>,
+                          public Objective<Typical, Resultant, Parametric...> {
+
+public:
+    /**
+     * @brief
+     *     Base class template instance alias.
+     */
+    using BaseObjective = Objective<Typical, Resultant, Parametric...>;
+
+    /** 
+     * @brief         
+     *     Construct a lane generic callable object reference.
+     * @param[in] object
+     *     The procedural call object which will be called by reference.
+     */
+    constexpr LanewiseObjective(Typical& object)
+        : Procedural<void, Cardinal, Resultant*, const Parametric*...>(this)
+        , BaseObjective(object)
+    {
+    }
+
+    /** 
+     * @brief         
+     *     Procedural object call operator.
+     * @details       
+     *     Calls the object with each Width elements of the argument arrays
+     *     and stores the result lanes, then calls it with each remaining 
+     *     element.
+     * @param[in] count
+     *     Number of elements of each array.
+     * @param[out] results
+     *     Array of count results.
+     * @param[in] ...arguments
+     *     Arrays of count arguments.
+     */
+    void operator()(Cardinal count, Resultant* results, const Parametric*... arguments) const PROCEDURE_MODULE_FINAL
+    {
+        const Cardinal vectorized = count & ~(Width - 1);
+        for (Cardinal index = 0; index < vectorized; index += Width)
+            Vectorial<Resultant, Width>(this->object(Vectorial<Parametric, Width>::Load(arguments + index)...)).store(results + index);
+        for (Cardinal index = vectorized; index < count; index++)
+            results[index] = this->object(arguments[index]...);
+    }
+};
+
+/**
+ * @brief         
+ *     Specify a lane generic callable object as a procedural call object 
+ *     over arrays.
+ * @details       
+ *     This function template is used to create a procedure which calls a 
+ *     callable object, such as a generic lambda expression, once for each 
+ *     Width elements of its argument arrays.  The guide specifies the 
+ *     element signature, and the procedure is a 
+ *     Procedural<void, Cardinal, Resultant*, const Parametric*...>.
+ * @tparam Width
+ *     Number of lanes of each call.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Result type of each element.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the element types of each argument.
+ * @param[in] object
+ *     Reference to the callable object which will be called.
+ * @param[in] guide
+ *     Used for template argument deduction, value is ignored.
+ * @return
+ *     Procedural object which references object.
+ */
+template <Cardinal Width, class Typical, class Resultant, class... Parametric>
+static constexpr LanewiseObjective<Typical, Width, Resultant, Parametric...>
+ProcureLanewise(
+    Typical&
+        object,
+    Functional<Resultant, Parametric...>*
+        guide)
+{
+    using Specific = LanewiseObjective<Typical, Width, Resultant, Parametric...>;
+    return Specific(object);
+}
+
+}
+
+#if !defined(PROCEDURE_MODULE_NOSTDCPP) && !defined(PROCEDURE_MODULE_NOVIRTUAL)
+namespace std {
+
+/**
+ * @brief
+ *     Standard hash specialization for comparable procedures.
+ * @details
+ *     Allows comparable procedures to key unordered containers, calling the
+ *     virtual hash function.  Define the macro PROCEDURE_MODULE_NOSTDCPP to
+ *     prevent this specialization.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Resultant, class... Parametric>
+struct hash<::procedure::ComparablyProcedural<Resultant, Parametric...>> {
+
+    /**
+     * @brief
+     *     Hash function call operator.
+     * @param[in] procedure
+     *     Procedure to be hashed.
+     * @return
+     *     Hash value of procedure.
+     */
+    size_t operator()(const ::procedure::ComparablyProcedural<Resultant, Parametric...>& procedure) const
+    {
+        return procedure.hash();
+    }
+};
+
+/**
+ * @brief
+ *     Standard hash specialization for comparable objectives.
+ * @tparam Typical
+ *     Type of the callable object.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class Resultant, class... Parametric>
+struct hash<::procedure::ComparablyObjective<Typical, Resultant, Parametric...>>
+    : hash<::procedure::ComparablyProcedural<Resultant, Parametric...>> {
+};
+
+/**
+ * @brief
+ *     Standard hash specialization for comparable methodics.
+ * @tparam Typical
+ *     Type of the object.
+ * @tparam MethodLocational
+ *     Pointer to member function type.
+ * @tparam Resultant
+ *     Return type of the call.
+ * @tparam ...Parametric
+ *     Parameter pack which represents the parameter types of the call.
+ */
+template <class Typical, class MethodLocational, class Resultant, class... Parametric>
+struct hash<::procedure::ComparablyMethodic<Typical, MethodLocational, Resultant, Parametric...>>
+    : hash<::procedure::ComparablyProcedural<Resultant, Parametric...>> {
+};
+
+}
+#endif
+
 #endif
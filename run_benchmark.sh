@@ -0,0 +1,11 @@
+#!/bin/sh
+# Requires (in PATH):
+# GNU coreutils (echo, date)
+# Clang LLVM (clang++)
+# Results after the compiler version are comma separated values (see 'benchmark.conditions')
+echo -n "When: " > benchmark_results.txt
+date -u >> benchmark_results.txt
+echo -n "Compiler: " >> benchmark_results.txt
+clang++ --version >> benchmark_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -o benchmark benchmark.cpp test_extern.cpp
+./benchmark >> benchmark_results.txt
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Requires (in PATH):
+# GNU coreutils (echo, date)
+# Clang LLVM (clang++)
+echo -n "When: " > concurrent_results.txt
+date -u >> concurrent_results.txt
+echo -n "Compiler: " >> concurrent_results.txt
+clang++ --version >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_queueing test_queueing.cpp
+echo "test_queueing:" >> concurrent_results.txt
+./test_queueing >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_executive test_executive.cpp
+echo "test_executive:" >> concurrent_results.txt
+./test_executive >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_instrumented test_instrumented.cpp test_extern.cpp
+echo "test_instrumented:" >> concurrent_results.txt
+./test_instrumented >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_publishing test_publishing.cpp
+echo "test_publishing:" >> concurrent_results.txt
+./test_publishing >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_memoized test_memoized.cpp
+echo "test_memoized:" >> concurrent_results.txt
+./test_memoized >> concurrent_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -pthread -o test_asynchronous test_asynchronous.cpp
+echo "test_asynchronous:" >> concurrent_results.txt
+./test_asynchronous >> concurrent_results.txt
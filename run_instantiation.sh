@@ -0,0 +1,31 @@
+#!/bin/sh
+# Requires (in PATH):
+# GNU coreutils (echo, date, seq)
+# GNU Time (time)
+# GNU Binutils (size, nm)
+# GNU sed, awk
+# Clang LLVM (clang++)
+# Generates 'instantiation.sites' with a distinct callable type per site, then reports the compile time,
+# the code (text), constant (rodata) and relocated constant (data.rel.ro) bytes of the object file of each
+# case, and the bytes of its virtual tables and type information in total and per site.
+sites=4000
+echo -n "When: " > instantiation_results.txt
+date -u >> instantiation_results.txt
+echo -n "Compiler: " >> instantiation_results.txt
+clang++ --version >> instantiation_results.txt
+echo "Sites: $sites" >> instantiation_results.txt
+seq 0 $(($sites - 1)) | sed 's/.*/INSTANTIATION_SITE(&)/' > instantiation.sites
+for case in procure comparable stdfunction delegating comparably_delegating
+do
+    echo "instantiation_$case:" >> instantiation_results.txt
+    time -p -a -o instantiation_results.txt clang++ -std=c++14 -pedantic -Wall -O -c -o instantiation_$case.o instantiation_$case.cpp
+    size -A -d instantiation_$case.o | awk '
+        $1 ~ /^\.text/ { text += $2 }
+        $1 ~ /^\.rodata/ { rodata += $2 }
+        $1 ~ /^\.data\.rel\.ro/ { relro += $2 }
+        END { print "text " text "\nrodata " rodata "\ndata.rel.ro " relro }' >> instantiation_results.txt
+    nm -C -S -t d --defined-only instantiation_$case.o | awk -v sites=$sites '
+        / vtable for / { vtable += $2 }
+        / typeinfo (name )?for / { typeinfo += $2 }
+        END { print "vtable " vtable + 0 " (" (vtable + 0) / sites " per site)\ntypeinfo " typeinfo + 0 " (" (typeinfo + 0) / sites " per site)" }' >> instantiation_results.txt
+done
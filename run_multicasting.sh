@@ -0,0 +1,10 @@
+#!/bin/sh
+# Requires (in PATH):
+# GNU coreutils (echo, date)
+# Clang LLVM (clang++)
+echo -n "When: " > multicasting_results.txt
+date -u >> multicasting_results.txt
+echo -n "Compiler: " >> multicasting_results.txt
+clang++ --version >> multicasting_results.txt
+clang++ -std=c++14 -pedantic -Wall -O -o test_multicasting test_multicasting.cpp test_extern.cpp
+./test_multicasting >> multicasting_results.txt
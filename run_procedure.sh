@@ -8,13 +8,31 @@ date -u >> procedure_results.txt
 echo -n "Compiler: " >> procedure_results.txt
 clang++ --version >> procedure_results.txt
 clang++ -std=c++14 -pedantic -Wall -O -o test_procedure test_procedure.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_statically test_statically.cpp test_extern.cpp
 clang++ -std=c++14 -pedantic -Wall -O -o test_stdfunction test_stdfunction.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_possessive test_possessive.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_thinly test_thinly.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_delegating test_delegating.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_repeatedly test_repeatedly.cpp test_extern.cpp
+clang++ -std=c++14 -pedantic -Wall -O -o test_alternative test_alternative.cpp
 loops=10
 while [ $loops -gt 0 ]
 do
     echo "test_procedure:" >> procedure_results.txt
     time -p -a -o procedure_results.txt ./test_procedure > /dev/null
+    echo "test_statically:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_statically > /dev/null
     echo "test_stdfunction:" >> procedure_results.txt
     time -p -a -o procedure_results.txt ./test_stdfunction > /dev/null
+    echo "test_possessive:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_possessive > /dev/null
+    echo "test_thinly:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_thinly > /dev/null
+    echo "test_delegating:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_delegating > /dev/null
+    echo "test_repeatedly:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_repeatedly > /dev/null
+    echo "test_alternative:" >> procedure_results.txt
+    time -p -a -o procedure_results.txt ./test_alternative > /dev/null
     loops=$[$loops - 1]
 done
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Requires (in PATH):
+# GNU coreutils (echo, date)
+# GNU Binutils (size, nm)
+# Clang LLVM (clang++)
+# Reports the flash (text, rodata) and RAM (data, bss) footprint of 'example.cpp' in the default and
+# PROCEDURE_MODULE_NOVIRTUAL profiles, followed by the size and section of each global symbol which
+# belongs to an instantiation of this library (t, T or W in text, d or V in data.rel.ro).
+echo -n "When: " > size_results.txt
+date -u >> size_results.txt
+echo -n "Compiler: " >> size_results.txt
+clang++ --version >> size_results.txt
+clang++ -std=c++14 -pedantic -Wall -Os -fno-rtti -fno-exceptions -DPROCEDURE_MODULE_NOTHROW -o example_virtual example.cpp
+clang++ -std=c++14 -pedantic -Wall -Os -fno-rtti -fno-exceptions -DPROCEDURE_MODULE_NOTHROW -DPROCEDURE_MODULE_NOVIRTUAL -o example_novirtual example.cpp
+for profile in virtual novirtual
+do
+    echo "example_$profile:" >> size_results.txt
+    size -A example_$profile | grep -E '^\.(text|rodata|data\.rel\.ro|data|bss) ' >> size_results.txt
+    nm -C -S --size-sort --defined-only example_$profile | grep 'procedure::' >> size_results.txt
+done
@@ -0,0 +1,32 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+
+using namespace procedure;
+
+// Called in this translation unit, so that the closed set dispatch may be inlined
+template <class Alternating>
+static void CallAlternative(const Alternating& call)
+{
+    call();
+}
+
+template <class Typical>
+static inline auto Produce(Typical& object)
+{
+    return Procure(object, Guide<void>);
+}
+
+template <class Typical, class MethodLocational>
+static inline auto Produce(Typical& object, MethodLocational method)
+{
+    return Procure(object, method, Guide<void>);
+}
+
+#define TEST_ALTERNATIVE Alternative<void(), SimplyObjective<Test1Typical, void>, SimplyObjective<Test2Typical, void>, SimplyObjective<Test3Typical, void>, SimplyMethodic<Test4Typical, Test4Methodic, void>>
+#define TEST_CALL CallAlternative<TEST_ALTERNATIVE>
+#define TEST_PRODUCE1 Produce<Test1Typical>
+#define TEST_PRODUCE2 Produce<Test2Typical>
+#define TEST_PRODUCE3 Produce<Test3Typical>
+#define TEST_PRODUCE4 Produce<Test4Typical, Test4Methodic>
+#include "test.conditions"
@@ -0,0 +1,196 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "concurrent.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+using TestExecutive = Executive<1024, 64>;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_CALLS 100000
+#define TEST_WORKERS 2
+#define TEST_SLOW_MILLISECONDS 20
+
+struct {
+    unsigned operator()(unsigned left, unsigned right) const { return left * right; }
+} Multiply;
+struct {
+    unsigned operator()(const unsigned& value) const { return value + 1; }
+} Increment;
+static atomic<unsigned> Touched(0);
+struct {
+    void operator()(unsigned value) const { Touched.fetch_add(value, memory_order_relaxed); }
+} Touch;
+struct {
+    unsigned operator()() const
+    {
+        this_thread::sleep_for(chrono::milliseconds(TEST_SLOW_MILLISECONDS));
+        return 42;
+    }
+} Slow;
+static unsigned Continued = 0;
+struct {
+    void operator()(unsigned& value) const { Continued = value; }
+} Continue;
+static bool Finished = false;
+struct {
+    void operator()() const { Finished = true; }
+} Finish;
+struct {
+    unsigned operator()() const { throw runtime_error("failed"); }
+} Fail;
+struct {
+    void operator()() const { throw runtime_error("failed"); }
+} FailVoid;
+// Throws from its second copy, which posting makes after the arguments are copied
+struct Fragile {
+    static unsigned copies;
+    Fragile() {}
+    Fragile(const Fragile&)
+    {
+        if (++copies == 2)
+            throw runtime_error("copied");
+    }
+};
+unsigned Fragile::copies = 0;
+struct {
+    void operator()(const Fragile&) const {}
+} Inspect;
+// Counts results destroyed, which only a constructed result may be
+struct Destroyed {
+    static unsigned count;
+    ~Destroyed() { count++; }
+};
+unsigned Destroyed::count = 0;
+
+int main()
+{
+    TestExecutive executive(TEST_WORKERS);
+    const auto multiply = Procure(Multiply, Guide<unsigned, unsigned, unsigned>);
+    const auto increment = Procure(Increment, Guide<unsigned, const unsigned&>);
+    const auto touch = Procure(Touch, Guide<void, unsigned>);
+    const auto proceed = Procure(Continue, Guide<void, unsigned&>);
+    const auto finish = Procure(Finish, Guide<void>);
+    const auto slow = Procure(Slow, Guide<unsigned>);
+    const auto fail = Procure(Fail, Guide<unsigned>);
+    const auto failVoid = Procure(FailVoid, Guide<void>);
+    const auto inspect = Procure(Inspect, Guide<void, const Fragile&>);
+    {
+        Asynchronous<Destroyed> handle;
+        Asynchronous<void> done;
+    }
+    Expect("unposted handles neither wait nor destroy a result", Destroyed::count == 0);
+    {
+        Asynchronous<unsigned> handle;
+        handle.then(proceed);
+        ProcureAsynchronously(executive, handle, fail);
+        bool thrown = false;
+        try {
+            handle.wait();
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        executive.wait();
+        Expect("exception of the call is rethrown", thrown && handle.ready() && Continued == 0);
+    }
+    {
+        Asynchronous<void> handle;
+        Finished = false;
+        handle.then(finish);
+        ProcureAsynchronously(executive, handle, failVoid);
+        bool thrown = false;
+        try {
+            handle.wait();
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        executive.wait();
+        Expect("exception of the void call is rethrown", thrown && !Finished);
+    }
+    {
+        // The destructor waits for a call which throws without hanging
+        Asynchronous<unsigned> handle;
+        ProcureAsynchronously(executive, handle, fail);
+    }
+    {
+        // The destructor of a handle whose post threw does not wait
+        Asynchronous<void> handle;
+        const Fragile fragile;
+        bool thrown = false;
+        try {
+            ProcureAsynchronously(executive, handle, inspect, fragile);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        Expect("exception of the post is rethrown", thrown && !handle.ready());
+    }
+    {
+        Asynchronous<unsigned> handle;
+        ProcureAsynchronously(executive, handle, multiply, 6U, 7U);
+        Expect("result", handle.wait() == 42 && handle.ready());
+    }
+    {
+        Asynchronous<unsigned> handle;
+        unsigned value = 41;
+        ProcureAsynchronously(executive, handle, increment, value);
+        value = 0;
+        Expect("copied argument", handle.wait() == 42);
+    }
+    {
+        Asynchronous<unsigned> handle;
+        ProcureAsynchronously(executive, handle, slow);
+        Expect("parked wait", handle.wait() == 42);
+    }
+    {
+        Asynchronous<void> handle;
+        ProcureAsynchronously(executive, handle, touch, 42U);
+        handle.wait();
+        Expect("void result", Touched.load() == 42);
+    }
+    {
+        Asynchronous<unsigned> handle;
+        ProcureAsynchronously(executive, handle, multiply, 2U, 3U);
+        handle.then(proceed);
+        handle.wait();
+        executive.wait();
+        Expect("continuation", Continued == 6);
+        Continued = 0;
+        handle.then(proceed);
+        Expect("continuation after completion", Continued == 6);
+    }
+    {
+        Asynchronous<void> handle;
+        handle.then(finish);
+        ProcureAsynchronously(executive, handle, touch, 1U);
+        handle.wait();
+        executive.wait();
+        Expect("void continuation", Finished);
+    }
+    unsigned long sum = 0;
+    const auto start = chrono::steady_clock::now();
+    for (unsigned call = 0; call < TEST_CALLS; call++) {
+        Asynchronous<unsigned> handle;
+        ProcureAsynchronously(executive, handle, multiply, call, 3U);
+        sum += handle.wait();
+    }
+    const auto middle = chrono::steady_clock::now();
+    for (unsigned call = 0; call < TEST_CALLS; call++) {
+        packaged_task<unsigned(unsigned, unsigned)> task(Multiply);
+        future<unsigned> result = task.get_future();
+        executive.post([&task, call] { task(call, 3U); });
+        sum -= result.get();
+    }
+    const auto finish_time = chrono::steady_clock::now();
+    Expect("equal results", sum == 0);
+    const double asynchronous = chrono::duration<double, nano>(middle - start).count() / TEST_CALLS;
+    const double packaged = chrono::duration<double, nano>(finish_time - middle).count() / TEST_CALLS;
+    printf("asynchronous %.1f ns, packaged_task %.1f ns\n", asynchronous, packaged);
+    return Failures;
+}
@@ -0,0 +1,120 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "awaitable.hpp"
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+using namespace procedure;
+
+#ifdef PROCEDURE_MODULE_COROUTINE
+// Counts every allocation, which are served from a static buffer and never freed
+static unsigned Allocations = 0;
+alignas(std::max_align_t) static unsigned char Heap[1 << 16];
+static Cardinal Used = 0;
+
+void* operator new(Cardinal size)
+{
+    const Cardinal aligned = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (Used + aligned > sizeof(Heap))
+        throw std::bad_alloc();
+    Allocations++;
+    Used += aligned;
+    return Heap + Used - aligned;
+}
+
+void operator delete(void*) noexcept
+{
+}
+
+void operator delete(void*, Cardinal) noexcept
+{
+}
+
+// Minimal eagerly started coroutine which is destroyed when it finishes
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+};
+
+// Asynchronous operation layer which completes pending operations later
+static const Procedural<void, int>* Pending = 0;
+static const Procedural<void>* Signalled = 0;
+static int Value = 0;
+
+static void Read(const Procedural<void, int>& done)
+{
+    Pending = &done;
+}
+
+static void Signal(const Procedural<void>& done)
+{
+    Signalled = &done;
+}
+
+static void Complete()
+{
+    if (const Procedural<void, int>* done = Pending) {
+        Pending = 0;
+        (*done)(++Value);
+    } else if (const Procedural<void>* done = Signalled) {
+        Signalled = 0;
+        (*done)();
+    }
+}
+
+static int Sum = 0;
+static bool Finished = false;
+
+static Task Consume(int count)
+{
+    for (int index = 0; index < count; index++) {
+        Sum += co_await ProcureAwaitably([](const Procedural<void, int>& done) { Read(done); }, Guide<void, int>);
+        co_await ProcureAwaitably([](const Procedural<void>& done) { Signal(done); }, Guide<void>);
+    }
+    // Completion before the initiating object returns resumes immediately
+    Sum += co_await ProcureAwaitably([](const Procedural<void, int>& done) { done(1000); }, Guide<void, int>);
+    Finished = true;
+}
+
+// Every completion is called before the initiating object returns
+static long Inline = 0;
+static bool Continued = false;
+
+static Task Synchronize(int count)
+{
+    for (int index = 0; index < count; index++) {
+        Inline += co_await ProcureAwaitably([](const Procedural<void, int>& done) { done(1); }, Guide<void, int>);
+        co_await ProcureAwaitably([](const Procedural<void>& done) { done(); }, Guide<void>);
+    }
+    Continued = true;
+}
+
+int main()
+{
+    // Synchronous completions continue the coroutine without growing the stack
+    const int synchronous = 1000000;
+    Synchronize(synchronous);
+    const bool continued = Continued && Inline == synchronous;
+    printf("%s: %d synchronous completions (sum %ld)\n", continued ? "Pass" : "Fail", synchronous * 2, Inline);
+    const int count = 100;
+    Allocations = 0;
+    Consume(count);
+    while (Pending || Signalled)
+        Complete();
+    const bool passed = Finished && Sum == count * (count + 1) / 2 + 1000 && Allocations == 1;
+    printf("%s: awaited %d operations (sum %d, allocations %u)\n", passed ? "Pass" : "Fail", count * 2 + 1, Sum, Allocations);
+    return passed && continued ? 0 : 1;
+}
+#else
+int main()
+{
+    puts("Skipped: coroutines are not supported");
+}
+#endif
@@ -1,12 +1,75 @@
-//  2019 Aaron Sami Abassi
+// © 2019 Aaron Sami Abassi
 // Licensed under the Academic Free License version 3.0
 #include "procedure.hpp"
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+#include "expect.conditions"
 
 using namespace procedure;
 
 // Link with test_extern.cpp (only)
 void CallProcedure(const Procedural<void>&);
 
+// Objects of distinct procedures which are compared
+struct Sink {
+    void operator()() {}
+    void run() {}
+    void stop() {}
+};
+static Sink Sinks[3];
+using SinkObjective = ComparablyObjective<Sink, void>;
+using SinkMethodic = ComparablyMethodic<Sink, decltype(&Sink::run), void>;
+
+static unsigned CheckComparable()
+{
+    std::unordered_set<SinkObjective> objectives;
+    std::unordered_set<SinkMethodic> methodics;
+    for (unsigned repeat = 0; repeat < 2; repeat++)
+        for (Sink& sink : Sinks) {
+            objectives.insert(ProcureComparably(sink, Guide<void>));
+            methodics.insert(ProcureComparably(sink, &Sink::run, Guide<void>));
+            methodics.insert(ProcureComparably(sink, &Sink::stop, Guide<void>));
+        }
+    Expect("unordered set dedups equal objectives", objectives.size() == 3 && objectives.count(ProcureComparably(Sinks[1], Guide<void>)) == 1);
+    Expect("unordered set dedups equal methodics", methodics.size() == 6 && methodics.count(ProcureComparably(Sinks[2], &Sink::stop, Guide<void>)) == 1);
+    const std::hash<ComparablyProcedural<void>> hasher;
+    const SinkObjective objective = ProcureComparably(Sinks[0], Guide<void>), same = ProcureComparably(Sinks[0], Guide<void>);
+    const SinkMethodic methodic = ProcureComparably(Sinks[0], &Sink::run, Guide<void>), twin = ProcureComparably(Sinks[0], &Sink::run, Guide<void>);
+    Expect("equal procedures hash equal", objective == same && objective.hash() == same.hash() && hasher(methodic) == hasher(twin) && hasher(objective) == objective.hash());
+    Expect("procedures of one object are unequal", !(objective == methodic) && !(methodic == ProcureComparably(Sinks[0], &Sink::stop, Guide<void>)));
+    // Each distinct procedure twice, of mixed classes, sorted through the procedural interface
+    using SinkProcedural = ComparablyProcedural<void>;
+    const SinkObjective objectivesTwice[] = { Sinks[2], Sinks[0], Sinks[1], Sinks[1], Sinks[0], Sinks[2] };
+    const SinkMethodic runsTwice[] = { { Sinks[1], &Sink::run }, { Sinks[0], &Sink::run }, { Sinks[2], &Sink::run }, { Sinks[0], &Sink::run }, { Sinks[2], &Sink::run }, { Sinks[1], &Sink::run } };
+    const SinkMethodic stopsTwice[] = { { Sinks[0], &Sink::stop }, { Sinks[2], &Sink::stop }, { Sinks[1], &Sink::stop }, { Sinks[2], &Sink::stop }, { Sinks[1], &Sink::stop }, { Sinks[0], &Sink::stop } };
+    std::vector<const SinkProcedural*> sorted;
+    for (unsigned index = 0; index < 6; index++) {
+        sorted.push_back(&objectivesTwice[index]);
+        sorted.push_back(&runsTwice[index]);
+        sorted.push_back(&stopsTwice[index]);
+    }
+    const auto less = [](const SinkProcedural* left, const SinkProcedural* right) { return *left < *right; };
+    bool weak = true;
+    for (const SinkProcedural* a : sorted)
+        for (const SinkProcedural* b : sorted) {
+            // Irreflexive and asymmetric, and incomparable exactly when equal
+            weak = weak && !(*a < *a) && !(*a < *b && *b < *a) && ((!(*a < *b) && !(*b < *a)) == (*a == *b));
+            for (const SinkProcedural* c : sorted)
+                weak = weak && (!(*a < *b && *b < *c) || *a < *c);
+        }
+    Expect("strict weak ordering consistent with equality", weak);
+    std::sort(sorted.begin(), sorted.end(), less);
+    bool found = true;
+    for (Cardinal index = 0; index < sorted.size(); index++) {
+        const auto bound = std::lower_bound(sorted.begin(), sorted.end(), sorted[index], less);
+        found = found && **bound == *sorted[index] && Cardinal(bound - sorted.begin()) == index - index % 2;
+    }
+    Expect("sorted equal procedures are adjacent and found by lower_bound", found);
+    return Failures;
+}
+
 template <class Typical>
 static inline auto Produce(Typical& object)
 {
@@ -24,4 +87,5 @@ static inline auto Produce(Typical& object, MethodLocational method)
 #define TEST_PRODUCE2 Produce<Test2Typical>
 #define TEST_PRODUCE3 Produce<Test3Typical>
 #define TEST_PRODUCE4 Produce<Test4Typical, Test4Methodic>
+#define TEST_CHECK CheckComparable
 #include "test.conditions"
@@ -0,0 +1,57 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+
+using namespace procedure;
+
+// Counts every copy and move construction of an intermediate result
+struct Counted {
+    static unsigned copies;
+    static unsigned moves;
+    int value;
+    Counted(int value) : value(value) {}
+    Counted(const Counted& copy) : value(copy.value) { copies++; }
+    Counted(Counted&& move) : value(move.value) { moves++; }
+    static void Reset() { copies = moves = 0; }
+};
+unsigned Counted::copies = 0;
+unsigned Counted::moves = 0;
+
+struct {
+    Counted operator()(int value) const { return Counted(value * 2); }
+} Doubled;
+struct {
+    int operator()(Counted counted) const { return counted.value + 1; }
+} Incremented;
+struct Negation {
+    int negate(int value) { return -value; }
+} Negated;
+
+#define EXPECT_DETAIL() printf(" (copies %u, moves %u)", Counted::copies, Counted::moves)
+#define EXPECT_RESET Counted::Reset
+#include "expect.conditions"
+
+static int Call(const Procedural<int, int>& call, int value)
+{
+    return call(value);
+}
+
+int main()
+{
+    const auto doubled = Procure(Doubled, Guide<Counted, int>);
+    const auto incremented = Procure(Incremented, Guide<int, Counted>);
+    const auto negated = Procure(Negated, &Negation::negate, Guide<int, int>);
+    const auto concrete = Compose(incremented, doubled, Guide<int, int>);
+    Expect("concrete composition", Call(concrete, 5) == 11 && Counted::copies == 0);
+    const Procedural<Counted, int>& inner = doubled;
+    const Procedural<int, Counted>& outer = incremented;
+    const auto virtuals = Compose(outer, inner, Guide<int, int>);
+    Expect("virtual composition", Call(virtuals, 5) == 11 && Counted::copies == 0);
+    const auto pipeline = Compose(negated, concrete, Guide<int, int>);
+    Expect("composition pipeline", Call(pipeline, 5) == -11 && Counted::copies == 0);
+    const auto tripled = [](Counted counted) { return counted.value * 3; };
+    const auto lambdas = Compose(tripled, Doubled, Guide<int, int>);
+    Expect("callable object composition", Call(lambdas, 2) == 12 && Counted::copies == 0);
+    return Failures;
+}
@@ -0,0 +1,143 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment
+#define TEST_EVENTS 1000000
+#define TEST_TARGETS 16
+
+// Change handler of a target, whose redraw is expensive
+static unsigned long Redraws = 0;
+struct Widget {
+    unsigned long value;
+    void changed(unsigned long latest)
+    {
+        Redraws++;
+        for (unsigned round = 0; round < 100; round++)
+            latest = latest * 6364136223846793005UL + 1442695040888963407UL;
+        value = latest;
+    }
+} Widgets[TEST_TARGETS];
+
+// Records the order of calls and moves the text of its argument
+static string Log;
+struct {
+    void operator()(string&& text) const { Log += static_cast<string&&>(text); }
+} Appender;
+
+static Deferring<64, string&&> Deferred;
+static const Procedural<void, string&&>* Appending;
+
+// Defers another call while it is being flushed
+struct {
+    void operator()(string&& text) const
+    {
+        Log += text;
+        Deferred.defer(*Appending, string("later"));
+    }
+} Redeferring;
+
+struct {
+    void operator()() const {}
+} Nothing;
+
+// Counts the live copies of an argument, whose call throws for one value
+struct Tracked {
+    static int live;
+    int value;
+    Tracked(int value) : value(value) { live++; }
+    Tracked(const Tracked& copy) : value(copy.value) { live++; }
+    Tracked(Tracked&& move) : value(move.value) { live++; }
+    ~Tracked() { live--; }
+};
+int Tracked::live = 0;
+struct {
+    void operator()(Tracked tracked) const
+    {
+        if (tracked.value == 1)
+            throw tracked.value;
+        Log += static_cast<char>('0' + tracked.value);
+    }
+} Thrower;
+
+int main()
+{
+    const auto appender = Procure(Appender, Guide<void, string&&>);
+    Appending = &appender;
+    const auto redeferring = Procure(Redeferring, Guide<void, string&&>);
+    Deferred.defer(appender, string("a"));
+    Deferred.defer(redeferring, string("b"));
+    Deferred.defer(appender, string("c"));
+    Expect("calls are deferred", Log.empty() && Deferred.length() == 3);
+    Deferred.flush();
+    Expect("flush calls in order", Log == "abc" && Deferred.length() == 1);
+    Deferred.flush();
+    Expect("calls deferred by a flush wait", Log == "abclater" && Deferred.length() == 0);
+    Deferred.defer(appender, string("x"));
+    Deferred.clear();
+    Deferred.flush();
+    Expect("clear discards calls", Log == "abclater");
+    static Deferring<4> bounded;
+    const auto nothing = Procure(Nothing, Guide<void>);
+    bool accepted = true;
+    for (unsigned count = 0; count < 4; count++)
+        accepted = bounded.defer(nothing) && accepted;
+    Expect("capacity is bounded", accepted && !bounded.defer(nothing));
+    bounded.clear();
+    static Deferring<4, Tracked> throwing;
+    const auto thrower = Procure(Thrower, Guide<void, Tracked>);
+    Log.clear();
+    for (int value = 0; value < 3; value++)
+        throwing.defer(thrower, Tracked(value));
+    bool thrown = false;
+    try {
+        throwing.flush();
+    } catch (int) {
+        thrown = true;
+    }
+    Expect("arguments of a call which throws are destroyed", thrown && Log == "0" && Tracked::live == 1 && throwing.length() == 1);
+    throwing.flush();
+    Expect("calls after one which throws remain pending", Log == "02" && Tracked::live == 0 && throwing.length() == 0);
+    // Redundant change events on the same target are coalesced with the latest value
+    static Deferring<TEST_TARGETS, unsigned long> changes;
+    using Change = ComparablyMethodic<Widget, decltype(&Widget::changed), void, unsigned long>;
+    static Change handlers[TEST_TARGETS] = {
+        { Widgets[0], &Widget::changed }, { Widgets[1], &Widget::changed }, { Widgets[2], &Widget::changed },
+        { Widgets[3], &Widget::changed }, { Widgets[4], &Widget::changed }, { Widgets[5], &Widget::changed },
+        { Widgets[6], &Widget::changed }, { Widgets[7], &Widget::changed }, { Widgets[8], &Widget::changed },
+        { Widgets[9], &Widget::changed }, { Widgets[10], &Widget::changed }, { Widgets[11], &Widget::changed },
+        { Widgets[12], &Widget::changed }, { Widgets[13], &Widget::changed }, { Widgets[14], &Widget::changed },
+        { Widgets[15], &Widget::changed }
+    };
+    bool coalesced = true;
+    for (unsigned long event = 0; event < 3 * TEST_TARGETS; event++)
+        coalesced = changes.coalesce(handlers[event % TEST_TARGETS], event) && coalesced;
+    Expect("coalesced to one call per target", coalesced && changes.length() == TEST_TARGETS);
+    Redraws = 0;
+    changes.flush();
+    Widget expected = {};
+    expected.changed(2 * TEST_TARGETS + 5);
+    Expect("coalesced calls have the latest arguments", Redraws == TEST_TARGETS + 1 && Widgets[5].value == expected.value);
+    const auto immediate = chrono::steady_clock::now();
+    for (unsigned long event = 0; event < TEST_EVENTS; event++)
+        handlers[event % TEST_TARGETS](event);
+    const auto deferred = chrono::steady_clock::now();
+    for (unsigned long event = 0; event < TEST_EVENTS; event++) {
+        changes.coalesce(handlers[event % TEST_TARGETS], event);
+        if (event % 1000 == 999)
+            changes.flush();
+    }
+    changes.flush();
+    const auto finish = chrono::steady_clock::now();
+    printf("nanoseconds per event: %.2f coalesced per 1000 events, %.2f immediate\n",
+        chrono::duration<double, nano>(finish - deferred).count() / TEST_EVENTS,
+        chrono::duration<double, nano>(deferred - immediate).count() / TEST_EVENTS);
+    return Failures;
+}
@@ -0,0 +1,113 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "concurrent.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+using TestExecutive = Executive<1024, 32>;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_RANGE (1 << 24)
+#define TEST_GRAIN 256
+#define TEST_WORKERS 64
+#define TEST_VISITED (1 << 20)
+
+static unsigned Values[TEST_RANGE];
+
+// Fine grained range body, each index is a few instructions of work
+struct {
+    void operator()(Cardinal first, Cardinal last) const
+    {
+        for (Cardinal index = first; index < last; index++)
+            Values[index] = Values[index] * 1664525U + 1013904223U;
+    }
+} Body;
+
+static atomic<unsigned> Visits[TEST_VISITED];
+
+// Counts each index visited, so a count other than one is an error
+struct {
+    void operator()(Cardinal first, Cardinal last) const
+    {
+        for (Cardinal index = first; index < last; index++)
+            Visits[index].fetch_add(1, memory_order_relaxed);
+    }
+} Visitor;
+
+// Checks that each index in a range which is not a multiple of the grain is visited once
+static bool Visit(Cardinal workers)
+{
+    TestExecutive executive(workers);
+    const Cardinal first = 3, last = TEST_VISITED - 5;
+    for (Cardinal index = 0; index < TEST_VISITED; index++)
+        Visits[index].store(0, memory_order_relaxed);
+    executive.iterate(first, last, Procure(Visitor, Guide<void, Cardinal, Cardinal>), TEST_GRAIN);
+    for (Cardinal index = 0; index < TEST_VISITED; index++)
+        if (Visits[index].load(memory_order_relaxed) != (index >= first && index < last))
+            return false;
+    return true;
+}
+
+// Throws from its copy constructor, so a post of it fails
+struct Throwing {
+    Throwing() {}
+    Throwing(const Throwing&) { throw 0; }
+    void operator()() const {}
+};
+
+// Checks that posts which throw, from outside and inside a worker, are not left pending
+static bool Recover()
+{
+    TestExecutive executive(2);
+    const Throwing throwing;
+    atomic<unsigned> thrown(0);
+    try {
+        executive.post(throwing);
+    } catch (int) {
+        thrown++;
+    }
+    executive.post([&executive, &throwing, &thrown] {
+        try {
+            executive.post(throwing);
+        } catch (int) {
+            thrown++;
+        }
+    });
+    executive.wait();
+    return thrown.load() == 2;
+}
+
+static double Measure(Cardinal workers)
+{
+    TestExecutive executive(workers);
+    const auto body = Procure(Body, Guide<void, Cardinal, Cardinal>);
+    executive.iterate(0, TEST_RANGE, body, TEST_GRAIN);
+    const auto start = chrono::steady_clock::now();
+    executive.iterate(0, TEST_RANGE, body, TEST_GRAIN);
+    const auto finish = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(finish - start).count();
+}
+
+int main()
+{
+    const Cardinal hardware = thread::hardware_concurrency();
+    const Cardinal limit = hardware && hardware < TEST_WORKERS ? hardware : TEST_WORKERS;
+    bool visited = true;
+    for (Cardinal workers = 1; workers <= TEST_WORKERS; workers *= 2)
+        visited = Visit(workers) && visited;
+    Expect("each index visited once before iterate returns", visited);
+    Expect("a post which throws is not left pending", Recover());
+    puts("workers milliseconds speedup");
+    const double single = Measure(1);
+    printf("1 %.3f 1.00\n", single);
+    for (Cardinal workers = 2; workers <= limit; workers *= 2) {
+        const double time = Measure(workers);
+        printf("%zu %.3f %.2f\n", static_cast<size_t>(workers), time, single / time);
+    }
+    return Failures;
+}
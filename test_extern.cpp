@@ -1,10 +1,17 @@
-//  2019 Aaron Sami Abassi
+// © 2019 Aaron Sami Abassi
 // Licensed under the Academic Free License version 3.0
 #include "procedure.hpp"
 #include <functional>
+#include <vector>
 
 using TestProcedural = procedure::Procedural<void>;
+using TestComparable = procedure::ComparablyProcedural<void>;
 using TestFunctional = std::function<void()>;
+using TestPossessive = procedure::Possessive<48, void>;
+using TestThinly = procedure::ThinlyProcedural<void>;
+using TestRepeatedly = procedure::RepeatedlyProcedural<void>;
+using TestMulticasting = procedure::Multicasting<1000, void>;
+using TestFunctions = std::vector<TestFunctional>;
 
 void CallProcedure(const TestProcedural& call)
 {
@@ -15,3 +22,39 @@ void CallFunction(const TestFunctional& call)
 {
     call();
 }
+
+void CallPossessive(const TestPossessive& call)
+{
+    call();
+}
+
+void CallThinly(TestThinly call)
+{
+    call();
+}
+
+void CallRepeatedly(const TestRepeatedly& call, procedure::Cardinal count)
+{
+    call(count);
+}
+
+void CallMulticasting(TestMulticasting& call)
+{
+    call();
+}
+
+void CallFunctions(const TestFunctions& calls)
+{
+    for (const TestFunctional& call : calls)
+        call();
+}
+
+bool CompareProcedure(const TestComparable& procedure, const TestComparable& relative)
+{
+    return procedure == relative;
+}
+
+bool CompareThinly(TestThinly procedure, TestThinly relative)
+{
+    return procedure == relative;
+}
@@ -0,0 +1,92 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+
+using namespace procedure;
+
+// Counts every copy and move construction of an argument
+struct Counted {
+    static unsigned copies;
+    static unsigned moves;
+    Counted() {}
+    Counted(const Counted&) { copies++; }
+    Counted(Counted&&) { moves++; }
+    static void Reset() { copies = moves = 0; }
+};
+unsigned Counted::copies = 0;
+unsigned Counted::moves = 0;
+
+// Move only argument, which can not be passed unless arguments are forwarded
+struct Unique {
+    Unique() {}
+    Unique(const Unique&) = delete;
+    Unique(Unique&&) {}
+};
+
+struct {
+    void operator()(Counted) const {}
+} ByValue;
+struct {
+    void operator()(Counted&&) const {}
+} ByRvalue;
+struct {
+    void operator()(const Counted&) const {}
+} ByReference;
+struct {
+    void operator()(Unique) const {}
+} ByUnique;
+struct {
+    void run(Counted) const {}
+    void take(Counted&&) const {}
+} ByMember;
+
+#define EXPECT_DETAIL() printf(" (copies %u, moves %u)", Counted::copies, Counted::moves)
+#define EXPECT_RESET Counted::Reset
+#include "expect.conditions"
+
+static void ExpectCounts(const char* name, unsigned copies, unsigned moves)
+{
+    Expect(name, Counted::copies == copies && Counted::moves == moves);
+}
+
+static void CallValue(const Procedural<void, Counted>& call)
+{
+    call(Counted());
+}
+
+static void CallRvalue(const Procedural<void, Counted&&>& call)
+{
+    call(Counted());
+}
+
+static void CallReference(const Procedural<void, const Counted&>& call)
+{
+    const Counted argument;
+    call(argument);
+}
+
+static void CallUnique(const Procedural<void, Unique>& call)
+{
+    call(Unique());
+}
+
+int main()
+{
+    CallValue(Procure(ByValue, Guide<void, Counted>));
+    ExpectCounts("objective by value", 0, 1);
+    CallRvalue(Procure(ByRvalue, Guide<void, Counted&&>));
+    ExpectCounts("objective by rvalue reference", 0, 0);
+    CallReference(Procure(ByReference, Guide<void, const Counted&>));
+    ExpectCounts("objective by constant reference", 0, 0);
+    CallValue(ProcureComparably(ByValue, Guide<void, Counted>));
+    ExpectCounts("comparable objective by value", 0, 1);
+    CallValue(Procure(ByMember, &decltype(ByMember)::run, Guide<void, Counted>));
+    ExpectCounts("methodic by value", 0, 1);
+    CallRvalue(Procure(ByMember, &decltype(ByMember)::take, Guide<void, Counted&&>));
+    ExpectCounts("methodic by rvalue reference", 0, 0);
+    CallValue(ProcureComparably(ByMember, &decltype(ByMember)::run, Guide<void, Counted>));
+    ExpectCounts("comparable methodic by value", 0, 1);
+    CallUnique(Procure(ByUnique, Guide<void, Unique>));
+    return Failures;
+}
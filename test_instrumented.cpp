@@ -0,0 +1,67 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "instrumented.hpp"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_LOOP 1000000
+#define TEST_THREADS 4
+
+struct Counter {
+    atomic<unsigned long> count;
+    void operator()() { count.fetch_add(1, memory_order_relaxed); }
+    int twice(int value) { return value * 2; }
+} Object = {};
+
+// Link with test_extern.cpp (only)
+void CallProcedure(const Procedural<void>&);
+
+#ifndef PROCEDURE_MODULE_NOINSTRUMENT
+static double Measure(const Procedural<void>& call)
+{
+    const auto start = chrono::steady_clock::now();
+    for (unsigned count = 0; count < TEST_LOOP; count++)
+        CallProcedure(call);
+    const auto finish = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(finish - start).count() / TEST_LOOP;
+}
+#endif
+
+int main()
+{
+    const auto sharded = ProcureInstrumentally<TEST_THREADS>(Object, Guide<void>);
+    thread threads[TEST_THREADS];
+    for (thread& each : threads)
+        each = thread([&] {
+            for (unsigned count = 0; count < TEST_LOOP; count++)
+                sharded();
+        });
+    for (thread& each : threads)
+        each.join();
+    const Instrumentation recorded = sharded.snapshot();
+    unsigned long long histogram = 0;
+    for (const unsigned long long bucket : recorded.buckets)
+        histogram += bucket;
+#ifdef PROCEDURE_MODULE_NOINSTRUMENT
+    Expect("calls are forwarded without instrumentation", Object.count == TEST_THREADS * TEST_LOOP && recorded.calls == 0);
+#else
+    Expect("sharded calls are counted", recorded.calls == TEST_THREADS * TEST_LOOP && histogram == recorded.calls);
+    const auto method = ProcureInstrumentally(Object, &Counter::twice, Guide<int, int>);
+    Expect("results are returned", method(21) == 42 && method.snapshot().calls == 1);
+    const auto plain = Procure(Object, Guide<void>);
+    auto referenced = Instrument(plain);
+    const double instrumented = Measure(referenced);
+    const double uninstrumented = Measure(plain);
+    Expect("referenced calls are counted", referenced.snapshot().calls == TEST_LOOP);
+    referenced.reset();
+    Expect("reset discards calls", referenced.snapshot().calls == 0);
+    printf("nanoseconds per call: %.2f instrumented, %.2f uninstrumented\n", instrumented, uninstrumented);
+#endif
+    return Failures;
+}
@@ -0,0 +1,81 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <chrono>
+#include <cstdio>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+using Lanes = Vectorial<float, 8>;
+using Spanning = Procedural<void, Cardinal, float*, const float*>;
+
+// Produces meaningful test times in my testing environment, when loops are vectorized (-O2 -march=native)
+#define TEST_ELEMENTS 4096
+#define TEST_LOOP 10000
+
+alignas(64) static float Inputs[TEST_ELEMENTS];
+alignas(64) static float Outputs[TEST_ELEMENTS];
+
+// Transform stage written once, generic over float and lanes of float
+static const auto Kernel = [](auto value) { return (value * 1.5f + 0.25f) * value - value / 4.0f; };
+
+__attribute__((noinline)) void Elements(const Procedural<float, float>& call, float* results, const float* arguments, Cardinal count)
+{
+    for (Cardinal index = 0; index < count; index++)
+        results[index] = call(arguments[index]);
+}
+
+__attribute__((noinline)) void Vectors(const Procedural<Lanes, Lanes>& call, float* results, const float* arguments, Cardinal count)
+{
+    for (Cardinal index = 0; index < count; index += 8)
+        call(Lanes::Load(arguments + index)).store(results + index);
+}
+
+__attribute__((noinline)) void Span(const Spanning& call, float* results, const float* arguments, Cardinal count)
+{
+    call(count, results, arguments);
+}
+
+template <class Callable>
+static double Measure(Callable call)
+{
+    const auto start = chrono::steady_clock::now();
+    for (unsigned count = 0; count < TEST_LOOP; count++)
+        call();
+    const auto finish = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(finish - start).count() / (static_cast<double>(TEST_LOOP) * TEST_ELEMENTS);
+}
+
+static bool Matches(Cardinal count)
+{
+    // Lanes may contract multiplication and addition differently from scalars
+    for (Cardinal index = 0; index < count; index++) {
+        const float expected = Kernel(Inputs[index]);
+        const float difference = Outputs[index] - expected;
+        if (difference > 1e-5f * (expected < 0 ? -expected : expected) + 1e-6f || -difference > 1e-5f * (expected < 0 ? -expected : expected) + 1e-6f)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    for (Cardinal index = 0; index < TEST_ELEMENTS; index++)
+        Inputs[index] = static_cast<float>(index % 97) / 7.0f;
+    const auto element = Procure(Kernel, Guide<float, float>);
+    const auto vector = Procure(Kernel, Guide<Lanes, Lanes>);
+    const auto span = ProcureLanewise<8>(Kernel, Guide<float, float>);
+    const auto wide = ProcureLanewise<16>(Kernel, Guide<float, float>);
+    Vectors(vector, Outputs, Inputs, TEST_ELEMENTS);
+    Expect("vector procedure", Matches(TEST_ELEMENTS));
+    Span(span, Outputs, Inputs, TEST_ELEMENTS - 3);
+    Expect("span procedure with remainder", Matches(TEST_ELEMENTS - 3));
+    const double elements = Measure([&] { Elements(element, Outputs, Inputs, TEST_ELEMENTS); });
+    const double vectors = Measure([&] { Vectors(vector, Outputs, Inputs, TEST_ELEMENTS); });
+    const double spans = Measure([&] { Span(span, Outputs, Inputs, TEST_ELEMENTS); });
+    const double wides = Measure([&] { Span(wide, Outputs, Inputs, TEST_ELEMENTS); });
+    printf("nanoseconds per element: %.3f element, %.3f vector, %.3f span, %.3f span16\n", elements, vectors, spans, wides);
+    printf("speedup: %.1f vector, %.1f span, %.1f span16\n", elements / vectors, elements / spans, elements / wides);
+    return Failures;
+}
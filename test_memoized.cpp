@@ -0,0 +1,109 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "memoized.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_LOOP 1000000
+#define TEST_KEYS 64
+#define TEST_THREADS 4
+
+// Expensive pure procedures, which count how often they are really called
+static atomic<unsigned long> Calls(0);
+struct {
+    unsigned long operator()(unsigned long key) const
+    {
+        Calls.fetch_add(1, memory_order_relaxed);
+        unsigned long value = key;
+        for (unsigned round = 0; round < 1000; round++)
+            value = value * 6364136223846793005UL + 1442695040888963407UL;
+        return value;
+    }
+} Mixer;
+struct {
+    size_t operator()(const string& text) const
+    {
+        Calls.fetch_add(1, memory_order_relaxed);
+        return text.size();
+    }
+} Parser;
+
+// Recursive procedure, which calls itself through the memoized procedure
+static const Procedural<unsigned long long, unsigned>* Fibonacci;
+struct {
+    unsigned long long operator()(unsigned index) const
+    {
+        Calls.fetch_add(1, memory_order_relaxed);
+        return index < 2 ? index : (*Fibonacci)(index - 1) + (*Fibonacci)(index - 2);
+    }
+} Recursive;
+
+static double Measure(const Procedural<unsigned long, unsigned long>& call)
+{
+    unsigned long sum = 0;
+    const auto start = chrono::steady_clock::now();
+    for (unsigned count = 0; count < TEST_LOOP; count++)
+        sum += call(count % TEST_KEYS);
+    const auto finish = chrono::steady_clock::now();
+    if (!sum)
+        Failures++;
+    return chrono::duration<double, nano>(finish - start).count() / TEST_LOOP;
+}
+
+int main()
+{
+    const auto mixer = Procure(Mixer, Guide<unsigned long, unsigned long>);
+    const auto memoized = Memoize<256>(mixer);
+    Calls = 0;
+    bool equal = true;
+    for (unsigned count = 0; count < 4; count++)
+        for (unsigned long key = 0; key < TEST_KEYS; key++)
+            equal = equal && memoized(key) == mixer(key);
+    Expect("results are cached", equal && Calls == TEST_KEYS + 4 * TEST_KEYS);
+    auto bounded = Memoize<16, 1>(mixer);
+    Calls = 0;
+    for (unsigned long key = 0; key < 1000; key++)
+        bounded(key);
+    bounded(999);
+    Expect("capacity is bounded and recent keys kept", Calls == 1000);
+    bounded.clear();
+    Calls = 0;
+    bounded(999);
+    Expect("clear discards results", Calls == 1);
+    const auto parser = Procure(Parser, Guide<size_t, const string&>);
+    const auto parsed = Memoize<64>(parser);
+    Calls = 0;
+    const bool sized = parsed("procedure") == 9 && parsed(string("procedure")) == 9;
+    Expect("reference keys are stored by value", sized && Calls == 1);
+    const auto recursive = Procure(Recursive, Guide<unsigned long long, unsigned>);
+    const auto fibonacci = Memoize<128>(recursive);
+    Fibonacci = &fibonacci;
+    Calls = 0;
+    Expect("recursive calls are cached", fibonacci(90) == 2880067194370816120ULL && Calls == 91);
+    const auto local = Memoize<256, 4, true>(mixer);
+    thread threads[TEST_THREADS];
+    atomic<bool> consistent(true);
+    Calls = 0;
+    for (thread& each : threads)
+        each = thread([&] {
+            for (unsigned count = 0; count < 100; count++)
+                for (unsigned long key = 0; key < TEST_KEYS; key++)
+                    if (local(key) != Mixer(key))
+                        consistent = false;
+        });
+    for (thread& each : threads)
+        each.join();
+    Expect("thread local tables", consistent && Calls == TEST_THREADS * (100 * TEST_KEYS + TEST_KEYS));
+    const double hit = Measure(memoized);
+    const double miss = Measure(mixer);
+    printf("nanoseconds per call: %.2f memoized, %.2f direct\n", hit, miss);
+    return Failures;
+}
@@ -0,0 +1,51 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+#include "expect.conditions"
+
+using namespace procedure;
+
+// Produces meaningful test results in my testing environment
+#define TEST_COUNT 100000
+
+static unsigned long Count = 0;
+struct Counter {
+    void operator()() { Count++; }
+    void run() { Count++; }
+} Objects[16];
+
+static Monotonic<TEST_COUNT * 40> Registrations;
+static Pooling<40, TEST_COUNT> Subscriptions;
+static const Procedural<void>* Retained[TEST_COUNT];
+using Subscription = decltype(ProcureComparably(Objects[0], Guide<void>));
+static const Subscription* Subscribed[TEST_COUNT];
+
+int main()
+{
+    // Mixed procedure types retained past the scope they were created in
+    for (Cardinal index = 0; index < TEST_COUNT; index++) {
+        Counter& object = Objects[index % 16];
+        if (index % 2)
+            Retained[index] = Registrations.retain(Procure(object, Guide<void>));
+        else
+            Retained[index] = Registrations.retain(ProcureComparably(object, &Counter::run, Guide<void>));
+    }
+    for (Cardinal index = 0; index < TEST_COUNT; index++)
+        (*Retained[index])();
+    Expect("monotonic retains every procedure", Count == TEST_COUNT);
+    while (Registrations.retain(ProcureComparably(Objects[0], Guide<void>)))
+        ;
+    Expect("monotonic refuses when full", Registrations.length() > sizeof(Registrations) - 2 * 40);
+    Registrations.clear();
+    Expect("monotonic clear releases every procedure", Registrations.length() == 0 && Registrations.retain(Procure(Objects[0], Guide<void>)));
+    for (Cardinal index = 0; index < TEST_COUNT; index++)
+        Subscribed[index] = Subscriptions.retain(ProcureComparably(Objects[index % 16], Guide<void>));
+    Expect("pooling refuses when full", !Subscriptions.retain(Procure(Objects[0], Guide<void>)));
+    Subscriptions.release(Subscribed[7]);
+    const auto reused = Subscriptions.retain(ProcureComparably(Objects[3], &Counter::run, Guide<void>));
+    Expect("pooling reuses a released slot", static_cast<const void*>(reused) == Subscribed[7]);
+    Subscriptions.clear();
+    Expect("pooling clear releases every procedure", Subscriptions.retain(Procure(Objects[0], Guide<void>)));
+    return Failures;
+}
@@ -0,0 +1,136 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+using TestMulticasting = Multicasting<1000, void>;
+using TestFunctions = vector<function<void()>>;
+
+// Link with test_extern.cpp (only)
+void CallMulticasting(TestMulticasting&);
+void CallFunctions(const TestFunctions&);
+
+// Produces meaningful test times in my testing environment (see 'run_multicasting.sh')
+#define TEST_CALLS 10000000
+
+unsigned long Count = 0;
+
+struct Subscriber {
+    void operator()() const { Count++; }
+} Subscribers[1000];
+
+using SubscriberProcedure = ComparablyObjective<Subscriber, void>;
+
+// Handlers which change the list they are called by
+using CheckedMulticasting = Multicasting<4, void>;
+static CheckedMulticasting* Checked = 0;
+static unsigned Calls[4] = {};
+struct Handler {
+    unsigned index;
+    void operator()() const { Calls[index]++; }
+};
+static Handler Handlers[4] = { { 0 }, { 1 }, { 2 }, { 3 } };
+static const ComparablyObjective<Handler, void>* Added = 0;
+struct SelfRemover {
+    void operator()() const;
+} Unsubscribing;
+struct Adder {
+    void operator()() const { Checked->add(*Added); }
+} Subscribing;
+struct Thrower {
+    void operator()() const
+    {
+        Checked->remove(ProcureComparably(Handlers[1], Guide<void>));
+        throw 0;
+    }
+} Throwing;
+static const auto Unsubscribed = ProcureComparably(Unsubscribing, Guide<void>);
+static const auto Subscribed = ProcureComparably(Subscribing, Guide<void>);
+static const auto Thrown = ProcureComparably(Throwing, Guide<void>);
+void SelfRemover::operator()() const
+{
+    Calls[0]++;
+    Checked->remove(Unsubscribed);
+}
+
+static void CheckBehaviour()
+{
+    CheckedMulticasting list;
+    Checked = &list;
+    const auto first = ProcureComparably(Handlers[1], Guide<void>);
+    const auto second = ProcureComparably(Handlers[2], Guide<void>);
+    Expect("add", list.add(first) && list.contains(first) && !list.contains(second) && list.length() == 1);
+    Expect("duplicate add", list.add(first) && list.length() == 2);
+    list();
+    Expect("duplicate called twice", Calls[1] == 2);
+    Expect("remove one duplicate", list.remove(first) && list.contains(first) && list.length() == 1);
+    Expect("remove absent", !list.remove(second));
+    Expect("full list", list.add(second) && list.add(second) && list.add(second) && !list.add(second));
+    list.clear();
+    Expect("clear", list.length() == 0 && !list.contains(first));
+    Calls[0] = Calls[1] = Calls[2] = 0;
+    list.add(Unsubscribed);
+    list.add(first);
+    list();
+    list();
+    Expect("handler removes itself while called", Calls[0] == 1 && Calls[1] == 2 && list.length() == 1 && !list.contains(Unsubscribed));
+    list.clear();
+    Calls[1] = Calls[2] = 0;
+    Added = &second;
+    list.add(Subscribed);
+    list();
+    Expect("added while called, not called until the next call", Calls[2] == 0 && list.contains(second));
+    list();
+    Expect("added entry called by the next call", Calls[2] == 1);
+    list.clear();
+    list.add(Thrown);
+    list.add(first);
+    list.add(second);
+    bool caught = false;
+    try {
+        list();
+    } catch (int) {
+        caught = true;
+    }
+    // The entry vacated before the throw is compacted, so its capacity is available again
+    Expect("compacted after a handler throws", caught && !list.contains(first) && list.add(first) && list.add(first) && !list.add(first));
+    Checked = 0;
+}
+
+template <class Invocable>
+static double Measure(size_t subscribers, Invocable invoke)
+{
+    const size_t dispatches = TEST_CALLS / subscribers;
+    const auto start = chrono::steady_clock::now();
+    for (size_t count = 0; count < dispatches; count++)
+        invoke();
+    const auto finish = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(finish - start).count() / dispatches;
+}
+
+int main()
+{
+    CheckBehaviour();
+    static const size_t Lengths[] = { 1, 10, 100, 1000 };
+    static TestMulticasting multicasting;
+    vector<SubscriberProcedure> procedures(begin(Subscribers), end(Subscribers));
+    puts("subscribers multicasting_ns stdfunction_ns");
+    for (size_t length : Lengths) {
+        multicasting.clear();
+        TestFunctions functions;
+        for (size_t index = 0; index < length; index++) {
+            multicasting.add(procedures[index]);
+            functions.push_back(Subscribers[index]);
+        }
+        const double multicast = Measure(length, [] { CallMulticasting(multicasting); });
+        const double function = Measure(length, [&] { CallFunctions(functions); });
+        printf("%zu %.2f %.2f\n", length, multicast, function);
+    }
+    return Failures || Count == 0;
+}
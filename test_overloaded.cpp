@@ -0,0 +1,58 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+#include "expect.conditions"
+
+using namespace procedure;
+
+struct Circle {
+    double radius;
+};
+struct Square {
+    double side;
+};
+struct Text {
+    const char* value;
+};
+
+// Visitor with one call operator per visited type
+struct {
+    double operator()(const Circle& circle) const { return 3.0 * circle.radius * circle.radius; }
+    double operator()(const Square& square) const { return square.side * square.side; }
+    double operator()(const Text&) const { return 0.0; }
+} Area;
+
+static unsigned Visits = 0;
+struct {
+    void operator()(int) const { Visits += 1; }
+    void operator()(int, int) const { Visits += 2; }
+} Visitor;
+
+static double Measure(const Procedural<double, const Circle&>& circle, const Procedural<double, const Square&>& square)
+{
+    return circle(Circle{ 2.0 }) + square(Square{ 3.0 });
+}
+
+int main()
+{
+    const auto area = Overload(Area, Guide<double, const Circle&>, Guide<double, const Square&>, Guide<double, const Text&>);
+    const Procedural<double, const Circle&>& circle = area;
+    const Procedural<double, const Square&>& square = area;
+    const Procedural<double, const Text&>& text = area;
+    Expect("circle signature", circle(Circle{ 1.0 }) == 3.0);
+    Expect("square signature", square(Square{ 2.0 }) == 4.0);
+    Expect("text signature", text(Text{ "none" }) == 0.0);
+    Expect("one object several signatures", Measure(area, area) == 21.0);
+    const auto copy = area;
+    const Procedural<double, const Square&>& copied = copy;
+    Expect("copied overloads", copied(Square{ 3.0 }) == 9.0);
+    const auto visitor = Overload(Visitor, Guide<void, int>, Guide<void, int, int>);
+    static_cast<const Procedural<void, int>&>(visitor)(0);
+    static_cast<const Procedural<void, int, int>&>(visitor)(0, 0);
+    Expect("different arities", Visits == 3);
+    const auto separate = sizeof(Procure(Area, Guide<double, const Circle&>)) * 3;
+    printf("overloaded %zu bytes, separate %zu bytes\n", sizeof(area), separate);
+    Expect("smaller than separate procedures", sizeof(area) < separate);
+    return Failures;
+}
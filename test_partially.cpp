@@ -0,0 +1,82 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+
+using namespace procedure;
+
+// Counts every copy and move construction of a bound argument
+struct Counted {
+    static unsigned copies;
+    static unsigned moves;
+    int value;
+    Counted(int value) : value(value) {}
+    Counted(const Counted& copy) : value(copy.value) { copies++; }
+    Counted(Counted&& move) : value(move.value) { moves++; }
+    bool operator==(const Counted& relative) const { return value == relative.value; }
+    bool operator<(const Counted& relative) const { return value < relative.value; }
+    static void Reset() { copies = moves = 0; }
+};
+unsigned Counted::copies = 0;
+unsigned Counted::moves = 0;
+
+static int Total = 0;
+
+// Has an equal to operator but no less than operator
+struct Tagged {
+    int value;
+    bool operator==(const Tagged& relative) const { return value == relative.value; }
+};
+
+struct {
+    void operator()(const Counted& bound, int value) const { Total = bound.value + value; }
+} Adder;
+struct Scaler {
+    int factor;
+    void scale(const Counted& bound, int offset, int value) { Total = factor * bound.value * value + offset; }
+} Scaled = { 2 };
+void Subtract(int bound, int value) { Total = bound - value; }
+void Measure(const char* bound, int value) { for (Total = value; *bound; bound++) Total++; }
+void Apply(void (*bound)(int, int), int value) { bound(value, 1); }
+void Tag(Tagged bound, int value) { Total = bound.value * value; }
+
+#define EXPECT_DETAIL() printf(" (total %d, copies %u, moves %u)", Total, Counted::copies, Counted::moves)
+#define EXPECT_RESET Counted::Reset
+#include "expect.conditions"
+
+static void Call(const Procedural<void, int>& call, int value)
+{
+    call(value);
+}
+
+int main()
+{
+    const Counted three(3);
+    const auto copied = ProcurePartially(Adder, Guide<void, int>, three);
+    Expect("lvalue bound argument is copied once", Counted::copies == 1 && Counted::moves == 0);
+    Call(copied, 4);
+    Expect("objective with bound argument", Total == 7 && Counted::copies == 0);
+    const auto moved = ProcurePartially(Scaled, &Scaler::scale, Guide<void, int>, Counted(5), 1);
+    Expect("rvalue bound argument is moved once", Counted::copies == 0 && Counted::moves == 1);
+    Call(moved, 3);
+    Expect("methodic with bound arguments", Total == 31 && Counted::copies == 0);
+    Call(ProcurePartially(Subtract, Guide<void, int>, 10), 4);
+    Expect("function with bound argument", Total == 6);
+    Call(ProcurePartially(Measure, Guide<void, int>, "hello"), 1);
+    Expect("string literal bound as a pointer", Total == 6);
+    Call(ProcurePartially(Apply, Guide<void, int>, Subtract), 8);
+    Expect("function bound as a function pointer", Total == 7);
+    const auto first = ProcureComparablyPartially(Scaled, &Scaler::scale, Guide<void, int>, Counted(5), 1);
+    const auto second = ProcureComparablyPartially(Scaled, &Scaler::scale, Guide<void, int>, Counted(5), 1);
+    const auto third = ProcureComparablyPartially(Scaled, &Scaler::scale, Guide<void, int>, Counted(6), 1);
+    const ComparablyProcedural<void, int>& procedure = first;
+    Expect("equal bound arguments compare equal", procedure == second && procedure.hash() == second.hash());
+    Expect("unequal bound arguments compare unequal", procedure != third);
+    Expect("bound arguments are ordered", (procedure < third) != (third < procedure) && !(procedure < second));
+    const auto tagged = ProcureComparablyPartially(Tag, Guide<void, int>, Tagged{ 2 });
+    const auto retagged = ProcureComparablyPartially(Tag, Guide<void, int>, Tagged{ 3 });
+    const ComparablyProcedural<void, int>& untagged = tagged;
+    Expect("bound argument without less than compares", untagged == ProcureComparablyPartially(Tag, Guide<void, int>, Tagged{ 2 }) && untagged != retagged);
+    Expect("bound argument without less than is left equivalent", !(untagged < retagged) && !(retagged < untagged));
+    return Failures;
+}
@@ -0,0 +1,82 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include "expect.conditions"
+
+using namespace procedure;
+using TestPossessive = Possessive<48, void>;
+using CountedPossessive = Possessive<48, int>;
+
+// Counts every construction and destruction of a possessed callable object
+struct Counted {
+    static unsigned copies, moves, destructions;
+    int value;
+    Counted(int value) : value(value) {}
+    Counted(const Counted& copy) : value(copy.value) { copies++; }
+    Counted(Counted&& move) : value(move.value) { moves++; }
+    ~Counted() { destructions++; }
+    int operator()() const { return value; }
+    static void Reset() { copies = moves = destructions = 0; }
+};
+unsigned Counted::copies = 0, Counted::moves = 0, Counted::destructions = 0;
+
+static unsigned CheckPossessive()
+{
+    {
+        const Counted one(1);
+        Counted::Reset();
+        CountedPossessive possessed(one);
+        Expect("lvalue copied once", Counted::copies == 1 && Counted::moves == 0 && possessed() == 1);
+        Counted::Reset();
+        CountedPossessive copied(possessed);
+        Expect("copy construction copies", Counted::copies == 1 && copied() == 1 && possessed() == 1);
+        Counted::Reset();
+        CountedPossessive moved(static_cast<CountedPossessive&&>(copied));
+        Expect("move construction moves", Counted::moves == 1 && Counted::copies == 0 && moved() == 1);
+        Counted::Reset();
+        CountedPossessive assigned(Counted(2));
+        Expect("rvalue moved once", Counted::moves == 1 && Counted::copies == 0 && assigned() == 2);
+        Counted::Reset();
+        assigned = possessed;
+        Expect("copy assignment replaces", Counted::destructions == 1 && Counted::copies == 1 && assigned() == 1);
+        Counted::Reset();
+        CountedPossessive& self = assigned;
+        assigned = self;
+        assigned = static_cast<CountedPossessive&&>(self);
+        Expect("self assignment is ignored", Counted::destructions == 0 && Counted::copies == 0 && Counted::moves == 0 && assigned() == 1);
+        Counted::Reset();
+        assigned.clear();
+        assigned.clear();
+        Expect("clear destroys once", Counted::destructions == 1 && !assigned);
+        CountedPossessive empty(assigned);
+        assigned = static_cast<CountedPossessive&&>(empty);
+        Expect("empty copied and moved", !empty && !assigned);
+        Counted::Reset();
+    }
+    // The objects of possessed, copied and moved from copied are destroyed, as is one
+    Expect("destruction destroys each possessed object", Counted::destructions == 4);
+    return Failures;
+}
+
+// Link with test_extern.cpp (only)
+void CallPossessive(const TestPossessive&);
+
+template <class Typical>
+static inline TestPossessive Produce(Typical& object)
+{
+    return object;
+}
+
+template <class Typical, class MethodLocational>
+static inline TestPossessive Produce(Typical& object, MethodLocational method)
+{
+    return Procure(object, method, Guide<void>);
+}
+
+#define TEST_CALL CallPossessive
+#define TEST_PRODUCE1 Produce<Test1Typical>
+#define TEST_PRODUCE2 Produce<Test2Typical>
+#define TEST_PRODUCE3 Produce<Test3Typical>
+#define TEST_PRODUCE4 Produce<Test4Typical, Test4Methodic>
+#define TEST_CHECK CheckPossessive
+#include "test.conditions"
@@ -0,0 +1,126 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "concurrent.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_DISPATCHES 1000000
+#define TEST_HANDLERS 16
+#define TEST_READERS 64
+// Period of the writer, which adds and removes a handler
+#define TEST_WRITE_PERIOD 100
+
+using TestProcedural = ComparablyProcedural<void, unsigned long&>;
+using TestPublishing = Publishing<TEST_HANDLERS + 1, TEST_READERS, void, unsigned long&>;
+
+struct Handler {
+    unsigned long weight;
+    void operator()(unsigned long& sum) const { sum += weight; }
+} Handlers[TEST_HANDLERS + 1];
+
+using HandlerProcedure = ComparablyObjective<const Handler, void, unsigned long&>;
+
+// Registry guarded by a mutex, which serializes every reader
+struct Locked {
+    mutex guard;
+    const TestProcedural* procedures[TEST_HANDLERS];
+    Cardinal count;
+    void operator()(unsigned long& sum)
+    {
+        lock_guard<mutex> lock(guard);
+        for (Cardinal index = 0; index < count; index++)
+            (*procedures[index])(sum);
+    }
+};
+
+static TestPublishing Published;
+static Locked Guarded;
+template <class Dispatching>
+static double Measure(Cardinal readers, Dispatching dispatch)
+{
+    thread threads[TEST_READERS];
+    atomic<bool> started(false);
+    atomic<unsigned long> total(0);
+    for (Cardinal reader = 0; reader < readers; reader++)
+        threads[reader] = thread([&, reader] {
+            while (!started.load(memory_order_acquire))
+                this_thread::yield();
+            unsigned long sum = 0;
+            for (unsigned count = 0; count < TEST_DISPATCHES; count++)
+                dispatch(reader, sum);
+            total.fetch_add(sum, memory_order_relaxed);
+        });
+    const auto start = chrono::steady_clock::now();
+    started.store(true, memory_order_release);
+    for (Cardinal reader = 0; reader < readers; reader++)
+        threads[reader].join();
+    const auto finish = chrono::steady_clock::now();
+    if (total.load() != readers * static_cast<unsigned long>(TEST_DISPATCHES) * TEST_HANDLERS)
+        Failures++;
+    return readers * static_cast<double>(TEST_DISPATCHES) / chrono::duration<double, micro>(finish - start).count();
+}
+
+int main()
+{
+    static HandlerProcedure procedures[] = {
+        Handlers[0], Handlers[1], Handlers[2], Handlers[3], Handlers[4], Handlers[5],
+        Handlers[6], Handlers[7], Handlers[8], Handlers[9], Handlers[10], Handlers[11],
+        Handlers[12], Handlers[13], Handlers[14], Handlers[15], Handlers[16]
+    };
+    bool added = true;
+    for (Cardinal index = 0; index < TEST_HANDLERS; index++) {
+        Handlers[index].weight = 1;
+        added = Published.add(procedures[index]) && added;
+        Guarded.procedures[index] = &procedures[index];
+    }
+    Guarded.count = TEST_HANDLERS;
+    Expect("add", added);
+    Expect("duplicate refused", !Published.add(HandlerProcedure(Handlers[0])));
+    Expect("contains", Published.contains(procedures[3]) && Published.length() == TEST_HANDLERS);
+    // A writer which adds and removes a handler of no weight while the readers call
+    atomic<bool> writing(true);
+    thread writer([&] {
+        while (writing.load(memory_order_acquire)) {
+            Published.add(procedures[TEST_HANDLERS]);
+            Published.remove(procedures[TEST_HANDLERS]);
+            this_thread::sleep_for(chrono::microseconds(TEST_WRITE_PERIOD));
+        }
+    });
+    // Queries by a thread which is not an online reader, while the writer changes the registry
+    bool queried = true;
+    for (unsigned query = 0; query < 1000; query++) {
+        const Cardinal length = Published.length();
+        queried = queried && Published.contains(procedures[0]) && (length == TEST_HANDLERS || length == TEST_HANDLERS + 1);
+        this_thread::yield();
+    }
+    Expect("queried while writing", queried);
+    const Cardinal hardware = thread::hardware_concurrency();
+    const Cardinal limit = hardware && hardware < TEST_READERS ? hardware : TEST_READERS;
+    puts("readers publishing_mdispatches mutex_mdispatches");
+    for (Cardinal readers = 1; readers <= limit; readers *= 2) {
+        const double published = Measure(readers, [](Cardinal reader, unsigned long& sum) {
+            Published.quiesce(reader);
+            Published(sum);
+        });
+        const double guarded = Measure(readers, [](Cardinal, unsigned long& sum) {
+            Guarded(sum);
+        });
+        for (Cardinal reader = 0; reader < readers; reader++)
+            Published.offline(reader);
+        printf("%zu %.2f %.2f\n", static_cast<size_t>(readers), published, guarded);
+    }
+    writing.store(false, memory_order_release);
+    writer.join();
+    Expect("removed", Published.remove(procedures[0]) && !Published.contains(procedures[0]));
+    Published.synchronize();
+    Expect("dispatch sums", Failures == 0 && Published.length() == TEST_HANDLERS - 1);
+    return Failures;
+}
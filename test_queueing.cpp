@@ -0,0 +1,120 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "concurrent.hpp"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment (see 'run_concurrent.sh')
+#define TEST_PRODUCERS 4
+#define TEST_POSTS 1000000
+
+unsigned long Count = 0;
+
+// Next post expected from each producer, posts of one producer are called in order
+static unsigned Next[TEST_PRODUCERS];
+static bool Ordered = true;
+
+// Called by the consumer for each post
+static void Consume(unsigned producer, unsigned post)
+{
+    if (Next[producer] != post)
+        Ordered = false;
+    Next[producer] = post + 1;
+    Count++;
+}
+
+// Throws from its copy constructor, so a post of it fails after claiming a slot
+struct Throwing {
+    Throwing() {}
+    Throwing(const Throwing&) { throw 0; }
+    void operator()() const { Count++; }
+};
+
+// Checks that a post which throws leaves a slot the consumer skips
+static bool Skip()
+{
+    Queueing<4, 32> queue;
+    const Throwing throwing;
+    unsigned thrown = 0;
+    for (unsigned post = 0; post < 3; post++)
+        try {
+            queue.post(throwing);
+        } catch (int) {
+            thrown++;
+        }
+    const unsigned long before = Count;
+    const bool posted = queue.post([] { Count++; });
+    return thrown == 3 && posted && queue.call() && Count == before + 1 && !queue.call();
+}
+
+// Baseline which every team writes, a mutex around a deque of std::function
+class Locking {
+public:
+    bool post(function<void()> call)
+    {
+        lock_guard<mutex> guard(exclusion);
+        calls.push_back(move(call));
+        return true;
+    }
+    bool call()
+    {
+        function<void()> call;
+        {
+            lock_guard<mutex> guard(exclusion);
+            if (calls.empty())
+                return false;
+            call = move(calls.front());
+            calls.pop_front();
+        }
+        call();
+        return true;
+    }
+
+private:
+    mutex exclusion;
+    deque<function<void()>> calls;
+};
+
+template <class Queuing>
+static double Measure(Queuing& queue)
+{
+    const unsigned long expected = Count + TEST_PRODUCERS * TEST_POSTS;
+    for (unsigned producer = 0; producer < TEST_PRODUCERS; producer++)
+        Next[producer] = 0;
+    const auto start = chrono::steady_clock::now();
+    vector<thread> producers;
+    for (unsigned producer = 0; producer < TEST_PRODUCERS; producer++)
+        producers.emplace_back([&queue, producer] {
+            for (unsigned post = 0; post < TEST_POSTS; post++)
+                while (!queue.post([producer, post] { Consume(producer, post); }))
+                    this_thread::yield();
+        });
+    while (Count < expected)
+        if (!queue.call())
+            this_thread::yield();
+    for (thread& producer : producers)
+        producer.join();
+    const auto finish = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(finish - start).count() / (TEST_PRODUCERS * TEST_POSTS);
+}
+
+int main()
+{
+    static Queueing<1024, 32> queueing;
+    static Locking locking;
+    printf("queueing_ns_per_post %.2f\n", Measure(queueing));
+    printf("locking_ns_per_post %.2f\n", Measure(locking));
+    Expect("every post called", Count == 2UL * TEST_PRODUCERS * TEST_POSTS);
+    Expect("posts of each producer called in order", Ordered);
+    Expect("a post which throws is skipped", Skip());
+    return Failures;
+}
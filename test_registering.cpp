@@ -0,0 +1,73 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include "expect.conditions"
+
+using namespace procedure;
+
+struct Point {
+    int x, y;
+};
+
+using TestRecorded = Recorded<int, const Point&>;
+using TestRegistering = Registering<8, int, int, const Point&>;
+
+static_assert(std::is_trivially_copyable<TestRecorded>::value, "Records must be trivially copyable");
+
+// Each instance stands for the same command in a different process
+struct Move {
+    int scale;
+    int operator()(int steps, const Point& point) const { return scale * steps * (point.x + point.y); }
+};
+struct Address {
+    const Point* last;
+    int operator()(int, const Point& point) { return last = &point, 0; }
+};
+
+int main()
+{
+    // Records are copied byte by byte, as through a queue in shared memory
+    alignas(TestRecorded) unsigned char ring[4 * sizeof(TestRecorded)];
+    Move producerMove{ 1 }, consumerMove{ 1 };
+    Address producerAddress{ 0 }, consumerAddress{ 0 };
+    const auto producerMoving = Procure(producerMove, Guide<int, int, const Point&>);
+    const auto producerAddressing = Procure(producerAddress, Guide<int, int, const Point&>);
+    const auto consumerMoving = Procure(consumerMove, Guide<int, int, const Point&>);
+    const auto consumerAddressing = Procure(consumerAddress, Guide<int, int, const Point&>);
+    TestRegistering producer, consumer;
+    const Cardinal move = producer.enroll(producerMoving);
+    const Cardinal address = producer.enroll(producerAddressing);
+    Expect("enrolled in turn", move == 0 && address == 1);
+    Expect("same order same identifiers", consumer.enroll(consumerMoving) == move && consumer.enroll(consumerAddressing) == address);
+    const TestRecorded written[] = { { move, 2, Point{ 3, 4 } }, { address, 0, Point{ 5, 6 } } };
+    memcpy(ring, written, sizeof written);
+    const TestRecorded* const records = reinterpret_cast<const TestRecorded*>(ring);
+    Expect("dispatched by identifier", consumer(records[0]) == 14);
+    consumer(records[1]);
+    Expect("dispatched in place", reinterpret_cast<const unsigned char*>(consumerAddress.last) > ring && reinterpret_cast<const unsigned char*>(consumerAddress.last) < ring + sizeof ring && consumerAddress.last->x == 5);
+    Expect("identifier resolved", consumer[move] == &consumerMoving && !consumer[7] && !consumer[8]);
+    Expect("explicit identifier", consumer.assign(7, consumerMoving) && !consumer.assign(7, consumerAddressing) && !consumer.assign(8, consumerMoving));
+    Expect("removed identifier", consumer.remove(move) && !consumer.contains(move) && !consumer.remove(move));
+    Expect("reused identifier", consumer.enroll(consumerMoving) == move);
+    TestRegistering full;
+    for (Cardinal each = 0; each < 8; each++)
+        full.enroll(consumerMoving);
+    Expect("full registry", full.enroll(consumerMoving) == 8);
+    // Records of identifiers which are unregistered or beyond the capacity are refused
+    const TestRecorded unregistered[] = { { 5, 1, Point{ 1, 1 } }, { 8, 1, Point{ 1, 1 } } };
+    Expect("unregistered record refused", consumer.contains(records[0]) && !consumer.contains(unregistered[0]) && !consumer.contains(unregistered[1]));
+#ifndef PROCEDURE_MODULE_NOTHROW
+    Cardinal thrown = 0;
+    for (const TestRecorded& record : unregistered)
+        try {
+            consumer(record);
+        } catch (Cardinal identifier) {
+            thrown += identifier == record.identifier;
+        }
+    Expect("unregistered dispatch throws the identifier", thrown == 2);
+#endif
+    return Failures;
+}
@@ -0,0 +1,27 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+
+using namespace procedure;
+
+// Link with test_extern.cpp (only)
+void CallRepeatedly(const RepeatedlyProcedural<void>&, Cardinal);
+
+template <class Typical>
+static inline auto Produce(Typical& object)
+{
+    return ProcureRepeatedly(object, Guide<void>);
+}
+
+template <class Typical, class MethodLocational>
+static inline auto Produce(Typical& object, MethodLocational method)
+{
+    return ProcureRepeatedly(object, method, Guide<void>);
+}
+
+#define TEST_BATCH CallRepeatedly
+#define TEST_PRODUCE1 Produce<Test1Typical>
+#define TEST_PRODUCE2 Produce<Test2Typical>
+#define TEST_PRODUCE3 Produce<Test3Typical>
+#define TEST_PRODUCE4 Produce<Test4Typical, Test4Methodic>
+#include "test.conditions"
@@ -0,0 +1,135 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include "expect.conditions"
+
+using namespace std;
+using namespace procedure;
+
+// Produces meaningful test times in my testing environment
+#define TEST_TIMERS (1 << 20)
+#define TEST_DELAYS (1 << 16)
+#define TEST_CHECKED 4096
+
+// Small wheels, so that timers are cascaded through every level and beyond its range
+using TestScheduling = Scheduling<TEST_CHECKED, 2, 3>;
+using BenchmarkScheduling = Scheduling<TEST_TIMERS>;
+
+static TestScheduling Checked;
+static BenchmarkScheduling Wheel;
+
+static unsigned long long Deadlines[TEST_CHECKED];
+static unsigned long long Fired[TEST_CHECKED];
+static unsigned Misfired = 0;
+
+// Records the tick of each call, so that it can be compared with the deadline
+struct Timer {
+    Cardinal index;
+    void operator()() const
+    {
+        if (Fired[index])
+            Misfired++;
+        Fired[index] = Checked.time();
+    }
+};
+static Timer Timers[TEST_CHECKED];
+
+static unsigned Periods = 0;
+struct {
+    void operator()() const
+    {
+        if (++Periods < 10)
+            Checked.arm(3, ProcureThinly(*this, Guide<void>));
+    }
+} Periodic;
+
+static unsigned long long Sink = 0;
+struct {
+    void operator()() const { Sink++; }
+} Count;
+
+static void CheckWheel()
+{
+    mt19937 random(1);
+    unsigned long long handles[TEST_CHECKED];
+    bool cancelled[TEST_CHECKED] = {};
+    unsigned long long latest = 0;
+    for (Cardinal index = 0; index < TEST_CHECKED; index++) {
+        Timers[index].index = index;
+        // Delays beyond the 64 tick range of the wheels are included
+        const unsigned long long delay = random() % 200;
+        handles[index] = Checked.arm(delay, ProcureThinly(Timers[index], Guide<void>));
+        Deadlines[index] = Checked.time() + (delay ? delay : 1);
+        latest = Deadlines[index] > latest ? Deadlines[index] : latest;
+        if (index % 64 == 63)
+            Checked.advance(random() % 3);
+    }
+    bool cancels = true;
+    for (Cardinal index = 0; index < TEST_CHECKED; index += 3)
+        if (Fired[index] || !Checked.pending(handles[index]))
+            continue;
+        else
+            cancels = cancels && Checked.cancel(handles[index]) && !Checked.cancel(handles[index]), cancelled[index] = true;
+    Expect("cancel once", cancels);
+    Checked.advance(latest - Checked.time());
+    bool exact = true;
+    for (Cardinal index = 0; index < TEST_CHECKED; index++)
+        exact = exact && (cancelled[index] ? !Fired[index] : Fired[index] == Deadlines[index]);
+    Expect("called at each deadline", exact && !Misfired);
+    Expect("empty wheel", Checked.length() == 0);
+    Expect("stale handle", !Checked.pending(handles[1]) && !Checked.cancel(handles[1]));
+    Checked.arm(3, ProcureThinly(Periodic, Guide<void>));
+    Checked.advance(100);
+    Expect("armed by a call", Periods == 10 && Checked.length() == 0);
+    Scheduling<2> full;
+    const auto count = ProcureThinly(Count, Guide<void>);
+    const unsigned long long first = full.arm(1, count);
+    Expect("full wheel", first && full.arm(1, count) && !full.arm(1, count));
+    Expect("reused entry", full.cancel(first) && full.arm(1, count) != first && full.advance() == 2);
+}
+
+static void CompareQueue()
+{
+    using Entry = pair<unsigned long long, function<void()>>;
+    struct Later {
+        bool operator()(const Entry& left, const Entry& right) const { return left.first > right.first; }
+    };
+    mt19937 random(2);
+    vector<unsigned long long> delays(TEST_TIMERS);
+    for (auto& delay : delays)
+        delay = 1 + random() % TEST_DELAYS;
+    const auto count = ProcureThinly(Count, Guide<void>);
+    Sink = 0;
+    auto start = chrono::steady_clock::now();
+    for (const auto delay : delays)
+        Wheel.arm(delay, count);
+    Wheel.advance(TEST_DELAYS);
+    const double wheel = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    const unsigned long long called = Sink;
+    start = chrono::steady_clock::now();
+    priority_queue<Entry, vector<Entry>, Later> queue;
+    for (const auto delay : delays)
+        queue.push(Entry(delay, [] { Sink++; }));
+    for (unsigned long long tick = 1; tick <= TEST_DELAYS; tick++)
+        while (!queue.empty() && queue.top().first <= tick) {
+            queue.top().second();
+            queue.pop();
+        }
+    const double heap = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    Expect("every timer called", called == TEST_TIMERS && Sink == 2ULL * TEST_TIMERS);
+    printf("%d timers: wheel %.1f ms, priority_queue of std::function %.1f ms\n", TEST_TIMERS, wheel, heap);
+}
+
+int main()
+{
+    CheckWheel();
+    CompareQueue();
+    return Failures;
+}
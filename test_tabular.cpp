@@ -0,0 +1,56 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+
+using namespace procedure;
+
+enum class Command {
+    Add,
+    Subtract,
+    Scale,
+    Reset
+};
+
+static int Total = 0;
+
+void Add(int value) { Total += value; }
+void Subtract(int value) { Total -= value; }
+
+struct Accumulator {
+    int factor;
+    void scale(int value) { Total += factor * value; }
+    void operator()(int value) { Total = value; }
+};
+static Accumulator Accumulated = { 3 };
+
+// Constant initialized, so it requires no static initializer
+constexpr auto Commands = ProcureTabularly<Command>(
+    ProcureThinly<decltype(&Add), &Add>(Guide<void, int>),
+    ProcureThinly<decltype(&Subtract), &Subtract>(Guide<void, int>),
+    ProcureThinly<decltype(&Accumulator::scale), &Accumulator::scale>(Accumulated, Guide<void, int>),
+    ProcureThinly(Accumulated, Guide<void, int>));
+
+static_assert(Commands.length() == 4, "Commands: Four entries expected");
+static_assert(Commands[Command::Reset] == ProcureThinly(Accumulated, Guide<void, int>), "Commands: Constant comparison expected");
+
+#define EXPECT_DETAIL() printf(" (total %d)", Total)
+#include "expect.conditions"
+
+static void ExpectTotal(const char* name, int total)
+{
+    Expect(name, Total == total);
+}
+
+int main()
+{
+    Commands(Command::Add, 5);
+    ExpectTotal("function by template argument", 5);
+    Commands(Command::Subtract, 2);
+    ExpectTotal("second function by template argument", 3);
+    Commands(Command::Scale, 2);
+    ExpectTotal("member function by template argument", 9);
+    Commands[Command::Reset](1);
+    ExpectTotal("call operator by subscript", 1);
+    return Failures;
+}
@@ -0,0 +1,81 @@
+// © 2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#include "procedure.hpp"
+#include <cstdio>
+#include "expect.conditions"
+
+using namespace procedure;
+
+static unsigned long Count = 0;
+struct Subscriber : Trackable {
+    void operator()() const { Count++; }
+    void run() const { Count += 10; }
+    int value() const { return 7; }
+};
+
+int main()
+{
+    // Calls reach a live object and are skipped once it is destroyed
+    {
+        Subscriber* subscriber = new Subscriber;
+        const auto objective = ProcureTrackably(*subscriber, Guide<void>);
+        const auto methodic = ProcureTrackably(*subscriber, &Subscriber::run, Guide<void>);
+        const auto valued = ProcureTrackably(*subscriber, &Subscriber::value, Guide<int>);
+        Count = 0;
+        objective();
+        methodic();
+        Expect("live calls", Count == 11 && objective.live() && methodic.live() && valued() == 7);
+        delete subscriber;
+        objective();
+        methodic();
+        Expect("destroyed calls skipped", Count == 11 && !objective.live() && !methodic.live());
+        Expect("destroyed result value initialized", valued() == 0);
+    }
+    // Copies track the same object, and procedures may die before it
+    {
+        using Tracked = TrackablyObjective<Subscriber, void>;
+        Subscriber* subscriber = new Subscriber;
+        const Tracked first(*subscriber);
+        {
+            const Tracked middle(*subscriber);
+            const Tracked copy(middle);
+            Expect("copy equal and live", copy == first && copy.live());
+        }
+        const Tracked last(first);
+        delete subscriber;
+        Expect("copies detached", !first.live() && !last.live());
+    }
+    // A copied object is not tracked by the procedures of the original
+    {
+        Subscriber original;
+        const auto procedure = ProcureTrackably(original, Guide<void>);
+        {
+            const Subscriber copy(original);
+        }
+        Expect("copy of object untracked", procedure.live());
+    }
+    // Multicasting prunes procedures whose object was destroyed lazily
+    {
+        static Multicasting<8, void> multicasting;
+        Subscriber kept;
+        Subscriber* dying = new Subscriber;
+        const auto keeping = ProcureTrackably(kept, Guide<void>);
+        const auto pruning = ProcureTrackably(*dying, &Subscriber::run, Guide<void>);
+        const auto plain = ProcureComparably(kept, &Subscriber::run, Guide<void>);
+        multicasting.add(keeping);
+        multicasting.add(pruning);
+        multicasting.add(plain);
+        Count = 0;
+        multicasting();
+        Expect("multicast live", Count == 21 && multicasting.length() == 3);
+        delete dying;
+        Expect("multicast prune deferred", multicasting.length() == 3);
+        Count = 0;
+        multicasting();
+        Expect("multicast pruned", Count == 11 && multicasting.length() == 2 && !multicasting.contains(pruning));
+        Count = 0;
+        multicasting();
+        Expect("multicast after prune", Count == 11 && multicasting.contains(plain));
+    }
+    return Failures;
+}